@@ -0,0 +1,434 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <base_codec/base16.hpp>
+#include <base_codec/base32.hpp>
+#include <base_codec/base64.hpp>
+#include <base_codec/dispatch.hpp>
+
+
+// NOTE - Every allocation made by the process is counted, so that the benchmarks can report how
+//        many allocations a single call makes.
+static std::atomic<std::size_t> allocation_count {0};
+
+auto operator new(std::size_t a_size) -> void*
+{
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+
+    if (auto* ret = std::malloc(a_size == 0 ? 1 : a_size))
+    {
+        return ret;
+    }
+
+    throw std::bad_alloc {};
+}
+
+auto operator delete(void* a_pointer) noexcept -> void
+{
+    std::free(a_pointer);
+}
+
+auto operator delete(
+    void* a_pointer,
+    std::size_t /* a_size */
+)
+noexcept -> void
+{
+    std::free(a_pointer);
+}
+
+namespace
+{
+
+using namespace rs::base_codec;
+
+/**
+ * Public routines of one codec, with the default padding and strictness.
+ */
+struct codec
+{
+    std::string_view name;
+    auto (*encode)(std::vector<std::uint8_t> const&, std::error_code&) -> std::string;
+    auto (*decode)(std::string_view const&, std::error_code&) -> std::vector<std::uint8_t>;
+    auto (*validate)(std::string_view const&) -> bool;
+};
+
+constexpr std::array<codec, 5> codecs {{
+    {
+        "base16",
+        [](std::vector<std::uint8_t> const& a_data, std::error_code& a_ec)
+        {
+            return base16_encode(a_data, a_ec);
+        },
+        [](std::string_view const& a_data, std::error_code& a_ec)
+        {
+            return base16_decode(a_data, a_ec);
+        },
+        [](std::string_view const& a_data) { return is_base16(a_data); }
+    },
+    {
+        "base32",
+        [](std::vector<std::uint8_t> const& a_data, std::error_code& a_ec)
+        {
+            return base32_encode(a_data, a_ec);
+        },
+        [](std::string_view const& a_data, std::error_code& a_ec)
+        {
+            return base32_decode(a_data, a_ec);
+        },
+        [](std::string_view const& a_data) { return is_base32(a_data); }
+    },
+    {
+        "base32hex",
+        [](std::vector<std::uint8_t> const& a_data, std::error_code& a_ec)
+        {
+            return base32hex_encode(a_data, a_ec);
+        },
+        [](std::string_view const& a_data, std::error_code& a_ec)
+        {
+            return base32hex_decode(a_data, a_ec);
+        },
+        [](std::string_view const& a_data) { return is_base32hex(a_data); }
+    },
+    {
+        "base64",
+        [](std::vector<std::uint8_t> const& a_data, std::error_code& a_ec)
+        {
+            return base64_encode(a_data, a_ec);
+        },
+        [](std::string_view const& a_data, std::error_code& a_ec)
+        {
+            return base64_decode(a_data, a_ec);
+        },
+        [](std::string_view const& a_data) { return is_base64(a_data); }
+    },
+    {
+        "base64url",
+        [](std::vector<std::uint8_t> const& a_data, std::error_code& a_ec)
+        {
+            return base64url_encode(a_data, a_ec);
+        },
+        [](std::string_view const& a_data, std::error_code& a_ec)
+        {
+            return base64url_decode(a_data, a_ec);
+        },
+        [](std::string_view const& a_data) { return is_base64url(a_data); }
+    }
+}};
+
+enum class payload
+{
+    random,
+    text
+};
+
+auto payload_name(payload a_payload) -> std::string_view
+{
+    return a_payload == payload::random ? "random" : "text";
+}
+
+/**
+ * Uniformly random bytes - the worst case for anything branching on the data.
+ */
+auto random_payload(std::size_t a_size) -> std::vector<std::uint8_t>
+{
+    std::mt19937 generator {static_cast<std::uint32_t>(a_size)};
+    std::uniform_int_distribution<int> distribution {0, 255};
+    std::vector<std::uint8_t> ret(a_size);
+
+    for (auto& datum : ret)
+    {
+        datum = static_cast<std::uint8_t>(distribution(generator));
+    }
+
+    return ret;
+}
+
+/**
+ * JSON log lines - what typically ends up in tokens, data URIs and message payloads.
+ */
+auto text_payload(std::size_t a_size) -> std::vector<std::uint8_t>
+{
+    constexpr std::array<std::string_view, 4> levels {"debug", "info", "warning", "error"};
+    constexpr std::array<std::string_view, 4> paths {
+        "/api/v1/users", "/api/v1/orders", "/static/app.js", "/healthz"
+    };
+
+    std::mt19937 generator {static_cast<std::uint32_t>(a_size)};
+    std::string text;
+    text.reserve(a_size + 256);
+
+    while (text.size() < a_size)
+    {
+        text += R"({"time":"2024-05-17T12:)";
+        text += std::to_string(10 + generator() % 50);
+        text += R"(:00Z","level":")";
+        text += levels[generator() % levels.size()];
+        text += R"(","path":")";
+        text += paths[generator() % paths.size()];
+        text += R"(","status":)";
+        text += std::to_string(200 + generator() % 300);
+        text += R"(,"bytes":)";
+        text += std::to_string(generator() % 65536);
+        text += "}\n";
+    }
+
+    return std::vector<std::uint8_t>(text.begin(), text.begin() + a_size);
+}
+
+// NOTE - The benchmarks run in registration order and each one is invoked several times while the
+//        iteration count is estimated, so only the data of the latest one is kept around - the
+//        64 MiB cases would otherwise add up to gigabytes.
+auto input(
+    payload a_payload,
+    std::size_t a_size
+)
+-> std::vector<std::uint8_t> const&
+{
+    static payload cached_payload {payload::random};
+    static std::size_t cached_size {static_cast<std::size_t>(-1)};
+    static std::vector<std::uint8_t> cached;
+
+    if (a_payload != cached_payload || a_size != cached_size)
+    {
+        cached = a_payload == payload::random ? random_payload(a_size) : text_payload(a_size);
+        cached_payload = a_payload;
+        cached_size = a_size;
+    }
+
+    return cached;
+}
+
+auto encoded_input(
+    codec const& a_codec,
+    payload a_payload,
+    std::size_t a_size
+)
+-> std::string const&
+{
+    static std::string_view cached_codec;
+    static payload cached_payload {payload::random};
+    static std::size_t cached_size {static_cast<std::size_t>(-1)};
+    static std::string cached;
+
+    if (a_codec.name != cached_codec || a_payload != cached_payload || a_size != cached_size)
+    {
+        std::error_code ec;
+        cached = a_codec.encode(input(a_payload, a_size), ec);
+        cached_codec = a_codec.name;
+        cached_payload = a_payload;
+        cached_size = a_size;
+    }
+
+    return cached;
+}
+
+auto bind_tier(
+    benchmark::State& a_state,
+    kernel_tier a_tier
+)
+-> bool
+{
+    std::error_code ec;
+
+    if (active_kernel_tier() != a_tier)
+    {
+        set_kernel_tier(a_tier, ec);
+    }
+
+    if (ec)
+    {
+        a_state.SkipWithError(ec.message().c_str());
+        return false;
+    }
+
+    return true;
+}
+
+// NOTE - Throughput is reported in payload (decoded) bytes for every operation, so that encode,
+//        decode and validate of the same size class line up.
+auto finish(
+    benchmark::State& a_state,
+    std::size_t a_size,
+    std::size_t a_allocations
+)
+-> void
+{
+    a_state.SetBytesProcessed(
+        static_cast<std::int64_t>(a_state.iterations()) * static_cast<std::int64_t>(a_size)
+    );
+    a_state.counters["allocs_per_call"] = benchmark::Counter(
+        static_cast<double>(a_allocations),
+        benchmark::Counter::kAvgIterations
+    );
+}
+
+auto encode(
+    benchmark::State& a_state,
+    codec const& a_codec,
+    kernel_tier a_tier,
+    payload a_payload
+)
+-> void
+{
+    auto const size = static_cast<std::size_t>(a_state.range(0));
+    auto const& data = input(a_payload, size);
+
+    if (!bind_tier(a_state, a_tier))
+    {
+        return;
+    }
+
+    std::error_code ec;
+    auto const allocations = allocation_count.load(std::memory_order_relaxed);
+
+    for (auto _ : a_state)
+    {
+        auto encoded = a_codec.encode(data, ec);
+        benchmark::DoNotOptimize(encoded.data());
+    }
+
+    finish(a_state, size, allocation_count.load(std::memory_order_relaxed) - allocations);
+}
+
+auto decode(
+    benchmark::State& a_state,
+    codec const& a_codec,
+    kernel_tier a_tier,
+    payload a_payload
+)
+-> void
+{
+    auto const size = static_cast<std::size_t>(a_state.range(0));
+    auto const& data = encoded_input(a_codec, a_payload, size);
+
+    if (!bind_tier(a_state, a_tier))
+    {
+        return;
+    }
+
+    // NOTE - One untimed decode up front, so that broken input isn't timed before being reported.
+    std::error_code ec;
+    a_codec.decode(data, ec);
+
+    if (ec)
+    {
+        a_state.SkipWithError(ec.message().c_str());
+        return;
+    }
+
+    auto const allocations = allocation_count.load(std::memory_order_relaxed);
+
+    for (auto _ : a_state)
+    {
+        auto decoded = a_codec.decode(data, ec);
+        benchmark::DoNotOptimize(decoded.data());
+    }
+
+    finish(a_state, size, allocation_count.load(std::memory_order_relaxed) - allocations);
+}
+
+auto validate(
+    benchmark::State& a_state,
+    codec const& a_codec,
+    kernel_tier a_tier,
+    payload a_payload
+)
+-> void
+{
+    auto const size = static_cast<std::size_t>(a_state.range(0));
+    auto const& data = encoded_input(a_codec, a_payload, size);
+
+    if (!bind_tier(a_state, a_tier))
+    {
+        return;
+    }
+
+    auto const allocations = allocation_count.load(std::memory_order_relaxed);
+
+    for (auto _ : a_state)
+    {
+        auto valid = a_codec.validate(data);
+        benchmark::DoNotOptimize(valid);
+    }
+
+    finish(a_state, size, allocation_count.load(std::memory_order_relaxed) - allocations);
+}
+
+}   // namespace
+
+
+auto main(int argc, char** argv) -> int
+{
+    constexpr std::array tiers {
+        kernel_tier::scalar,
+        kernel_tier::sse41,
+        kernel_tier::avx2,
+        kernel_tier::avx512
+    };
+    constexpr std::array payloads {payload::random, payload::text};
+    constexpr std::array operations {
+        std::pair {"encode", &encode},
+        std::pair {"decode", &decode},
+        std::pair {"validate", &validate}
+    };
+
+    // NOTE - Names are `<codec>_<operation>/<tier>/<payload>/<size>` and don't depend on the
+    //        machine beyond the tiers it supports, so JSON reports of different commits can be
+    //        diffed with Google Benchmark's compare.py.
+    for (auto const& codec : codecs)
+    {
+        for (auto const& [operation, function] : operations)
+        {
+            for (auto const tier : tiers)
+            {
+                if (!is_kernel_tier_supported(tier))
+                {
+                    continue;
+                }
+
+                for (auto const payload : payloads)
+                {
+                    auto const name =
+                        std::string(codec.name) + "_" + operation + "/" +
+                        std::string(kernel_tier_name(tier)) + "/" +
+                        std::string(payload_name(payload));
+
+                    benchmark::RegisterBenchmark(name.c_str(), function, codec, tier, payload)
+                        ->RangeMultiplier(8)
+                        ->Range(8, std::int64_t {64} << 20);
+                }
+            }
+        }
+    }
+
+    benchmark::AddCustomContext("base_codec_version", BASE_CODEC_BENCH_VERSION);
+    benchmark::AddCustomContext(
+        "base_codec_best_kernel",
+        std::string(kernel_tier_name(best_kernel_tier()))
+    );
+
+    benchmark::Initialize(&argc, argv);
+
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        return 1;
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    return 0;
+}
@@ -0,0 +1,138 @@
+/**
+ * @file alphabet.hpp
+ *
+ * Compile time descriptions of the alphabets and the lookup tables generated from them. Every
+ * codec is built out of these - there are no alphabet tables that need initializing at runtime.
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+
+namespace rs
+{
+namespace base_codec
+{
+
+/**
+ * @brief RFC 4648 Base16 alphabet. Decoding accepts lower case digits as well.
+ */
+struct base16_alphabet
+{
+    static constexpr std::string_view symbols = "0123456789ABCDEF";
+    static constexpr std::size_t bits = 4;
+    static constexpr std::size_t block_size = 1;
+    static constexpr std::size_t block_symbols = 2;
+    static constexpr bool has_padding = false;
+    static constexpr bool accepts_lower_case = true;
+};
+
+/**
+ * @brief RFC 4648 Base32 alphabet.
+ */
+struct base32_alphabet
+{
+    static constexpr std::string_view symbols = "ABCDEFGHIJKLMNOPQRSTUVWXYZ234567";
+    static constexpr std::size_t bits = 5;
+    static constexpr std::size_t block_size = 5;
+    static constexpr std::size_t block_symbols = 8;
+    static constexpr bool has_padding = true;
+    static constexpr bool accepts_lower_case = false;
+};
+
+/**
+ * @brief RFC 4648 Base32 alphabet with the extended hex digits.
+ */
+struct base32hex_alphabet
+{
+    static constexpr std::string_view symbols = "0123456789ABCDEFGHIJKLMNOPQRSTUV";
+    static constexpr std::size_t bits = 5;
+    static constexpr std::size_t block_size = 5;
+    static constexpr std::size_t block_symbols = 8;
+    static constexpr bool has_padding = true;
+    static constexpr bool accepts_lower_case = false;
+};
+
+/**
+ * @brief RFC 4648 Base64 alphabet.
+ */
+struct base64_alphabet
+{
+    static constexpr std::string_view symbols =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    static constexpr std::size_t bits = 6;
+    static constexpr std::size_t block_size = 3;
+    static constexpr std::size_t block_symbols = 4;
+    static constexpr bool has_padding = true;
+    static constexpr bool accepts_lower_case = false;
+};
+
+/**
+ * @brief RFC 4648 Base64 alphabet with the URL and filename safe symbols.
+ */
+struct base64url_alphabet
+{
+    static constexpr std::string_view symbols =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+    static constexpr std::size_t bits = 6;
+    static constexpr std::size_t block_size = 3;
+    static constexpr std::size_t block_symbols = 4;
+    static constexpr bool has_padding = true;
+    static constexpr bool accepts_lower_case = false;
+};
+
+namespace detail
+{
+
+/**
+ * Marks a character outside the alphabet in the decode tables. Every valid value is below 64,
+ * so OR-ing the lookups of a whole block and testing the top bits catches any invalid character
+ * without a branch per character.
+ */
+inline constexpr std::uint8_t invalid_symbol = 0xFF;
+
+/**
+ * Builds a table mapping every character to its value in the alphabet, or to `invalid_symbol`.
+ */
+constexpr auto make_decode_table(
+    std::string_view a_alphabet,
+    bool a_accepts_lower_case = false
+)
+-> std::array<std::uint8_t, 256>
+{
+    std::array<std::uint8_t, 256> ret {};
+
+    for (auto& value : ret)
+    {
+        value = invalid_symbol;
+    }
+
+    for (std::size_t i = 0; i < a_alphabet.size(); ++i)
+    {
+        auto const symbol = static_cast<unsigned char>(a_alphabet[i]);
+        ret[symbol] = static_cast<std::uint8_t>(i);
+
+        if (a_accepts_lower_case && symbol >= 'A' && symbol <= 'Z')
+        {
+            ret[symbol - 'A' + 'a'] = static_cast<std::uint8_t>(i);
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * Decode table of an alphabet.
+ */
+template <typename Alphabet>
+inline constexpr auto decode_table = make_decode_table(
+    Alphabet::symbols,
+    Alphabet::accepts_lower_case
+);
+
+}   // namespace detail
+}   // namespace base_codec
+}   // namespace rs
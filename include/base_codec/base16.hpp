@@ -1,17 +1,56 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <iterator>
+#include <memory_resource>
+#include <span>
 #include <string>
 #include <vector>
+#include <cstddef>
 #include <cstdint>
 #include <string_view>
 #include <system_error>
 
+#include <base_codec/byte_range.hpp>
+#include <base_codec/constant.hpp>
+#include <base_codec/fixed.hpp>
+#include <base_codec/sink.hpp>
+#include <base_codec/stream.hpp>
+#include <base_codec/validation.hpp>
+
 
 namespace rs
 {
 namespace base_codec
 {
 
+/**
+ * @brief Returns the length of the Base16 encoding of a given number of bytes.
+ *
+ * @param[in] a_size Number of bytes to encode.
+ *
+ * @returns std::size_t Exact number of characters the encoder writes.
+ */
+constexpr auto base16_encoded_size(std::size_t a_size) -> std::size_t
+{
+    return a_size * 2;
+}
+
+/**
+ * @brief Returns the number of bytes a Base16 encoded string decodes to - exact for any strictly
+ * valid string, and an upper bound for anything the lenient decoder would accept.
+ *
+ * @param[in] a_data Base16 encoded string.
+ *
+ * @returns std::size_t Number of bytes the decoder needs room for.
+ */
+constexpr auto base16_decoded_size(std::string_view const& a_data) -> std::size_t
+{
+    return a_data.size() / 2;
+}
+
 /**
  * @brief Encodes a vector of bytes as a Base16 string.
  *
@@ -27,7 +66,45 @@ auto base16_encode(
 -> std::string;
 
 /**
- * @brief Decodes a Base16 encoded string.
+ * @brief Encodes bytes as a Base16 string into a caller provided buffer, without allocating.
+ *
+ * @param[in] a_data Bytes to encode.
+ * @param[out] a_out Buffer to write the encoded string into. Has to hold at least
+ * `base16_encoded_size(a_data.size())` characters.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs, e.g. if the buffer is
+ * too small.
+ *
+ * @returns std::size_t Number of characters written. 0 if an error occurred.
+ */
+auto base16_encode_into(
+    std::span<std::uint8_t const> a_data,
+    std::span<char> a_out,
+    std::error_code& a_ec
+)
+-> std::size_t;
+
+/**
+ * @brief Encodes the bytes at the start of a buffer as Base16 within the same buffer, expanding
+ * them from the back, so no second buffer is needed.
+ *
+ * @param[in][out] a_buffer Buffer holding the bytes to encode at its start, with room for the
+ * encoding - at least `base16_encoded_size(a_size)` characters in total.
+ * @param[in] a_size Number of bytes to encode.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs, e.g. if the buffer is
+ * too small.
+ *
+ * @returns std::size_t Number of characters written to the start of the buffer. 0 if an error
+ * occurred.
+ */
+auto base16_encode_inplace(
+    std::span<char> a_buffer,
+    std::size_t a_size,
+    std::error_code& a_ec
+)
+-> std::size_t;
+
+/**
+ * @brief Decodes a Base16 encoded string. Both upper and lower case hex digits are accepted.
  *
  * @param[in] a_data Base16 encoded string to decode.
  * @param[in][out] a_ec std::error_code that gets set if a problem occurs.
@@ -45,7 +122,47 @@ auto base16_decode(
 -> std::vector<std::uint8_t>;
 
 /**
- * @brief Checks if the string contains invalid Base16 characters.
+ * @brief Decodes a Base16 encoded string into a caller provided buffer, without allocating.
+ *
+ * @param[in] a_data Base16 encoded string to decode.
+ * @param[out] a_out Buffer to write the decoded bytes into. Has to hold at least
+ * `base16_decoded_size(a_data)` bytes.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs, e.g. if the buffer is
+ * too small.
+ * @param[in] a_strict Enable/disable strict mode, see `base16_decode`.
+ *
+ * @returns std::size_t Number of bytes written. 0 if an error occurred.
+ */
+auto base16_decode_into(
+    std::string_view const& a_data,
+    std::span<std::uint8_t> a_out,
+    std::error_code& a_ec,
+    bool a_strict = true
+)
+-> std::size_t;
+
+/**
+ * @brief Decodes a Base16 encoded buffer in place - the decoded bytes overwrite the buffer from
+ * its start, which is safe as the output never catches up with the input.
+ *
+ * @param[in][out] a_buffer Buffer holding the Base16 encoded string, which receives the decoded
+ * bytes.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs.
+ * @param[in] a_strict Enable/disable strict mode, see `base16_decode`.
+ *
+ * @returns std::size_t Number of bytes decoded to the start of the buffer. 0 if an error occurred,
+ * in which case the buffer contents are unspecified.
+ */
+auto base16_decode_inplace(
+    std::span<char> a_buffer,
+    std::error_code& a_ec,
+    bool a_strict = true
+)
+-> std::size_t;
+
+/**
+ * @brief Checks if the string is valid Base16 - every character is a hex digit (lower case ones
+ * are considered valid) and there is an even number of them.
  *
  * @param[in] String to check for conformance.
  *
@@ -54,6 +171,472 @@ auto base16_decode(
  */
 auto is_base16(std::string_view const& a_data) -> bool;
 
+/**
+ * @brief Checks if the string is valid Base16 and reports where the first problem is.
+ *
+ * @param[in] a_data String to check for conformance.
+ * @param[out] a_error Set to the offset and value of the first invalid character, when the
+ * function returns false.
+ *
+ * @returns true If the string is possibly Base16 encoded.
+ * @returns false If the string can't be Base16 encoded, or at least not strictly.
+ */
+auto is_base16(
+    std::string_view const& a_data,
+    validation_error& a_error
+)
+-> bool;
+
+/**
+ * @brief Encodes any contiguous range of bytes (`std::string`, `std::span<std::byte const>`,
+ * `std::array`, ...) as a Base16 string, without copying it into a vector first. Note that a
+ * string literal passed directly includes its terminating null.
+ *
+ * @param[in] a_data Bytes to encode.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs.
+ *
+ * @returns std::string The encoded string. Empty if an error occurred.
+ */
+template <byte_range Range>
+auto base16_encode(
+    Range const& a_data,
+    std::error_code& a_ec
+)
+-> std::string
+{
+    std::string ret(base16_encoded_size(std::ranges::size(a_data)), '\0');
+    base16_encode_into(detail::as_byte_span(a_data), ret, a_ec);
+    return ret;
+}
+
+/**
+ * @brief Encodes any contiguous range of bytes as a Base16 string into any contiguous, writable
+ * range of characters.
+ *
+ * @returns std::size_t Number of characters written. 0 if an error occurred.
+ */
+template <byte_range Range, byte_range Output>
+auto base16_encode_into(
+    Range const& a_data,
+    Output&& a_out,
+    std::error_code& a_ec
+)
+-> std::size_t
+{
+    return base16_encode_into(
+        detail::as_byte_span(a_data),
+        detail::as_writable_char_span(a_out),
+        a_ec
+    );
+}
+
+/**
+ * @brief Decodes a Base16 encoded string directly into the given container type, e.g.
+ * `base16_decode<std::string>(data, ec)`.
+ *
+ * @param[in] a_data Base16 encoded string to decode.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs.
+ * @param[in] a_strict Enable/disable strict mode, see `base16_decode`.
+ *
+ * @returns Container Byte representation of the decoded string.
+ */
+template <byte_container Container>
+auto base16_decode(
+    std::string_view const& a_data,
+    std::error_code& a_ec,
+    bool a_strict = true
+)
+-> Container
+{
+    Container ret;
+    ret.resize(base16_decoded_size(a_data));
+    ret.resize(base16_decode_into(a_data, detail::as_writable_byte_span(ret), a_ec, a_strict));
+    return ret;
+}
+
+/**
+ * @brief Decodes a Base16 encoded string into any contiguous, writable range of bytes.
+ *
+ * @returns std::size_t Number of bytes written. 0 if an error occurred.
+ */
+template <byte_range Output>
+auto base16_decode_into(
+    std::string_view const& a_data,
+    Output&& a_out,
+    std::error_code& a_ec,
+    bool a_strict = true
+)
+-> std::size_t
+{
+    return base16_decode_into(a_data, detail::as_writable_byte_span(a_out), a_ec, a_strict);
+}
+
+/**
+ * @brief Appends the Base16 encoding of the data to an existing string, growing it only once.
+ *
+ * @param[in] a_data Bytes to encode.
+ * @param[in][out] a_out String to append the encoded data to.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs.
+ *
+ * @returns std::size_t Number of characters appended.
+ */
+template <byte_range Range>
+auto base16_encode_append(
+    Range const& a_data,
+    std::string& a_out,
+    std::error_code& a_ec
+)
+-> std::size_t
+{
+    auto const offset = a_out.size();
+    a_out.resize(offset + base16_encoded_size(std::ranges::size(a_data)));
+
+    auto const written = base16_encode_into(
+        detail::as_byte_span(a_data),
+        std::span<char>(a_out).subspan(offset),
+        a_ec
+    );
+
+    a_out.resize(offset + written);
+    return written;
+}
+
+/**
+ * @brief Encodes the data as Base16 and hands it to the callback in chunks, as
+ * `std::string_view`s that are only valid for the duration of the call. Nothing gets allocated.
+ *
+ * @param[in] a_data Bytes to encode.
+ * @param[in] a_callback Callable taking a `std::string_view` of encoded characters.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs.
+ */
+template <byte_range Range, std::invocable<std::string_view> Callback>
+auto base16_encode_to(
+    Range const& a_data,
+    Callback&& a_callback,
+    std::error_code& a_ec
+)
+-> void
+{
+    detail::encode_in_chunks<1, 2>(
+        detail::as_byte_span(a_data),
+        a_ec,
+        [&](
+            std::span<std::uint8_t const> a_chunk,
+            std::span<char> a_buffer,
+            std::error_code& a_chunk_ec
+        )
+        {
+            return base16_encode_into(a_chunk, a_buffer, a_chunk_ec);
+        },
+        a_callback
+    );
+}
+
+/**
+ * @brief Encodes the data as Base16 into an output iterator, e.g. a `std::back_inserter` or a
+ * `std::ostreambuf_iterator`.
+ *
+ * @param[in] a_data Bytes to encode.
+ * @param[in] a_out Iterator to write the encoded characters to.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs.
+ *
+ * @returns OutputIt The iterator past the last character written.
+ */
+template <byte_range Range, std::output_iterator<char> OutputIt>
+auto base16_encode_to(
+    Range const& a_data,
+    OutputIt a_out,
+    std::error_code& a_ec
+)
+-> OutputIt
+{
+    base16_encode_to(
+        a_data,
+        [&](std::string_view a_chunk) { a_out = std::copy(a_chunk.begin(), a_chunk.end(), a_out); },
+        a_ec
+    );
+
+    return a_out;
+}
+
+/**
+ * @brief Encodes any contiguous range of bytes as a Base16 string allocated from the given memory
+ * resource.
+ *
+ * @param[in] a_data Bytes to encode.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs.
+ * @param[in] a_resource Memory resource to allocate the string from, e.g. a per request arena or
+ * a `huge_page_resource`.
+ *
+ * @returns std::pmr::string The encoded string. Empty if an error occurred.
+ */
+template <byte_range Range>
+auto base16_encode(
+    Range const& a_data,
+    std::error_code& a_ec,
+    std::pmr::memory_resource* a_resource
+)
+-> std::pmr::string
+{
+    std::pmr::string ret(base16_encoded_size(std::ranges::size(a_data)), '\0', a_resource);
+    base16_encode_into(detail::as_byte_span(a_data), ret, a_ec);
+    return ret;
+}
+
+/**
+ * @brief Decodes a Base16 encoded string into a vector allocated from the given memory resource.
+ *
+ * @param[in] a_data Base16 encoded string to decode.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs.
+ * @param[in] a_resource Memory resource to allocate the vector from.
+ * @param[in] a_strict Enable/disable strict mode, see `base16_decode`.
+ *
+ * @returns std::pmr::vector<std::uint8_t> Byte representation of the decoded string.
+ */
+inline auto base16_decode(
+    std::string_view const& a_data,
+    std::error_code& a_ec,
+    std::pmr::memory_resource* a_resource,
+    bool a_strict = true
+)
+-> std::pmr::vector<std::uint8_t>
+{
+    std::pmr::vector<std::uint8_t> ret(base16_decoded_size(a_data), a_resource);
+    ret.resize(base16_decode_into(
+        a_data,
+        std::span<std::uint8_t>(ret),
+        a_ec,
+        a_strict
+    ));
+    return ret;
+}
+
+/**
+ * @brief Encodes a stream of bytes as Base16 one chunk at a time, in constant memory. Every byte
+ * is a whole block, so nothing ever gets held back between chunks.
+ */
+class base16_encoder
+{
+public:
+    /**
+     * @brief Returns the number of characters `update()` writes for a chunk of the given size.
+     */
+    auto max_update_size(std::size_t a_size) const -> std::size_t;
+
+    /**
+     * @brief Returns the most characters `finish()` can write.
+     */
+    static constexpr auto max_finish_size() -> std::size_t
+    {
+        return 0;
+    }
+
+    /**
+     * @brief Encodes the next chunk of the stream.
+     *
+     * @param[in] a_data Next chunk of bytes.
+     * @param[out] a_out Buffer of at least `max_update_size(a_data.size())` characters.
+     * @param[in][out] a_ec std::error_code that gets set if the buffer is too small.
+     *
+     * @returns std::size_t Number of characters written.
+     */
+    auto update(
+        std::span<std::uint8_t const> a_data,
+        std::span<char> a_out,
+        std::error_code& a_ec
+    )
+    -> std::size_t;
+
+    /**
+     * @brief Encodes the next chunk of the stream, appending it to a string.
+     */
+    template <byte_range Range, typename Traits, typename Allocator>
+    auto update(
+        Range const& a_data,
+        std::basic_string<char, Traits, Allocator>& a_out,
+        std::error_code& a_ec
+    )
+    -> void
+    {
+        auto const offset = a_out.size();
+        a_out.resize(offset + max_update_size(std::ranges::size(a_data)));
+        a_out.resize(offset + update(
+            detail::as_byte_span(a_data),
+            std::span<char>(a_out).subspan(offset),
+            a_ec
+        ));
+    }
+
+    /**
+     * @brief Ends the stream. Base16 has no partial blocks or padding, so nothing gets written.
+     *
+     * @returns std::size_t Number of characters written, always 0.
+     */
+    auto finish(
+        std::span<char> a_out,
+        std::error_code& a_ec
+    )
+    -> std::size_t;
+
+    /**
+     * @brief Ends the stream, see above.
+     */
+    template <typename Traits, typename Allocator>
+    auto finish(
+        std::basic_string<char, Traits, Allocator>& /* a_out */,
+        std::error_code& a_ec
+    )
+    -> void
+    {
+        finish(std::span<char>(), a_ec);
+    }
+};
+
+/**
+ * @brief Decodes a Base16 stream one chunk at a time, in constant memory.
+ *
+ * Chunks can be split anywhere - a dangling hex digit is carried over to the next chunk, and
+ * whole pairs go through the same kernels as `base16_decode`. After an error the stream can't be
+ * continued, only ended with `finish()`, which also gets the decoder ready for a new stream.
+ */
+class base16_decoder
+{
+public:
+    /**
+     * @param[in] a_strict Enable/disable strict mode, see `base16_decode`.
+     */
+    explicit base16_decoder(bool a_strict = true);
+
+    /**
+     * @brief Returns the most bytes `update()` can write for a chunk of the given size.
+     */
+    auto max_update_size(std::size_t a_size) const -> std::size_t;
+
+    /**
+     * @brief Decodes the next chunk of the stream.
+     *
+     * @param[in] a_data Next chunk of Base16 characters.
+     * @param[out] a_out Buffer of at least `max_update_size(a_data.size())` bytes.
+     * @param[in][out] a_ec std::error_code that gets set if a problem occurs.
+     *
+     * @returns std::size_t Number of bytes written. 0 if an error occurred.
+     */
+    auto update(
+        std::string_view const& a_data,
+        std::span<std::uint8_t> a_out,
+        std::error_code& a_ec
+    )
+    -> std::size_t;
+
+    /**
+     * @brief Decodes the next chunk of the stream, appending it to a byte container.
+     */
+    template <byte_container Container>
+    auto update(
+        std::string_view const& a_data,
+        Container& a_out,
+        std::error_code& a_ec
+    )
+    -> void
+    {
+        auto const offset = std::ranges::size(a_out);
+        a_out.resize(offset + max_update_size(a_data.size()));
+        a_out.resize(offset + update(
+            a_data,
+            detail::as_writable_byte_span(a_out).subspan(offset),
+            a_ec
+        ));
+    }
+
+    /**
+     * @brief Ends the stream and gets the decoder ready for a new one.
+     *
+     * @param[in][out] a_ec std::error_code that gets set if, in strict mode, the stream ended with
+     * a dangling hex digit.
+     */
+    auto finish(std::error_code& a_ec) -> void;
+
+private:
+    bool m_strict;
+    detail::decoder_state m_state;
+};
+
+/**
+ * @brief Encodes a constant as Base16 at compile time.
+ *
+ * @tparam Padding Should the encoding be padded with '=' characters.
+ * @param[in] a_data Bytes to encode.
+ *
+ * @returns std::array<char, N> Encoded characters, without a terminating null character.
+ */
+template <bool Padding = false, std::size_t Size>
+consteval auto base16_encode_constant(std::array<std::uint8_t, Size> const& a_data)
+-> std::array<char, detail::constant_encoded_size<base16_alphabet, Padding>(Size)>
+{
+    return detail::encode_constant<base16_alphabet, Padding>(a_data);
+}
+
+/**
+ * @brief Decodes a Base16 constant at compile time, e.g. `base16_decode_constant<"666F6F">()`.
+ * Input that `base16_decode` would reject in strict mode doesn't compile.
+ *
+ * @returns std::array<std::uint8_t, N> Decoded bytes.
+ */
+template <fixed_string Encoded>
+consteval auto base16_decode_constant()
+-> std::array<std::uint8_t, detail::constant_symbols<base16_alphabet>(Encoded.view()) * 4 / 8>
+{
+    return detail::decode_constant<base16_alphabet, Encoded>();
+}
+
+/**
+ * @brief Encodes a fixed size input (a digest, UUID or key) as Base16 with fully unrolled code.
+ *
+ * @param[in] a_data Bytes to encode.
+ *
+ * @returns std::array<char, N> Encoded characters, without a terminating null character.
+ */
+template <std::size_t Size>
+constexpr auto base16_encode_fixed(std::array<std::uint8_t, Size> const& a_data)
+-> std::array<char, base16_encoded_size(Size)>
+{
+    return detail::encode_fixed<base16_alphabet, false>(a_data);
+}
+
+/**
+ * @brief Decodes the Base16 encoding of a fixed size value with fully unrolled code.
+ *
+ * @tparam Size Number of bytes to decode, e.g. `base16_decode_fixed<32>(digest, ec)`.
+ * @param[in] a_data Base16 encoding of exactly `Size` bytes.
+ * @param[in][out] a_ec std::error_code that gets set if the input has the wrong length or holds
+ * any character outside the alphabet.
+ *
+ * @returns std::array<std::uint8_t, Size> Decoded bytes. All zero if an error occurred.
+ */
+template <std::size_t Size>
+constexpr auto base16_decode_fixed(
+    std::string_view const& a_data,
+    std::error_code& a_ec
+)
+-> std::array<std::uint8_t, Size>
+{
+    return detail::decode_fixed<base16_alphabet, false, Size>(a_data, a_ec);
+}
+
+namespace literals
+{
+
+/**
+ * @brief Decodes a Base16 literal at compile time, e.g. `"666F6F"_hex`.
+ */
+template <fixed_string Encoded>
+consteval auto operator""_hex()
+{
+    return base16_decode_constant<Encoded>();
+}
+
+}   // namespace literals
+
 }   // namespace base_codec
 }   // namespace rs
 
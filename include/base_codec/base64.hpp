@@ -5,18 +5,77 @@
  */
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <iterator>
+#include <memory_resource>
+#include <span>
 #include <string>
 #include <vector>
+#include <cstddef>
 #include <cstdint>
 #include <string_view>
 #include <system_error>
 
+#include <base_codec/byte_range.hpp>
+#include <base_codec/constant.hpp>
+#include <base_codec/fixed.hpp>
+#include <base_codec/sink.hpp>
+#include <base_codec/stream.hpp>
+#include <base_codec/validation.hpp>
+
 
 namespace rs
 {
 namespace base_codec
 {
 
+/**
+ * @brief Returns the length of the Base64/Base64Url encoding of a given number of bytes.
+ *
+ * @param[in] a_size Number of bytes to encode.
+ * @param[in] a_padding Will the encoding be padded.
+ *
+ * @returns std::size_t Exact number of characters the encoder writes.
+ */
+constexpr auto base64_encoded_size(
+    std::size_t a_size,
+    bool a_padding = true
+)
+-> std::size_t
+{
+    return a_padding
+        ? ((a_size + 2) / 3) * 4
+        : (a_size / 3) * 4 + ((a_size % 3) * 4 + 2) / 3;
+}
+
+/**
+ * @brief Returns the number of bytes a Base64/Base64Url encoded string decodes to. Trailing padding
+ * characters get discarded, so the result is exact for any strictly valid string (with or without
+ * padding), and an upper bound for anything the lenient decoder would accept.
+ *
+ * @param[in] a_data Base64/Base64Url encoded string.
+ * @param[in] a_pad_character Character to recognize as a padding character.
+ *
+ * @returns std::size_t Number of bytes the decoder needs room for.
+ */
+constexpr auto base64_decoded_size(
+    std::string_view const& a_data,
+    char a_pad_character = '='
+)
+-> std::size_t
+{
+    auto symbols = a_data.size();
+
+    while (symbols > 0 && a_data[symbols - 1] == a_pad_character)
+    {
+        --symbols;
+    }
+
+    return (symbols / 4) * 3 + ((symbols % 4) * 3) / 4;
+}
+
 /**
  * @brief Encodes a vector of bytes as a Base64 string.
  *
@@ -36,6 +95,54 @@ auto base64_encode(
 )
 -> std::string;
 
+/**
+ * @brief Encodes bytes as a Base64 string into a caller provided buffer, without allocating.
+ *
+ * @param[in] a_data Bytes to encode.
+ * @param[out] a_out Buffer to write the encoded string into. Has to hold at least
+ * `base64_encoded_size(a_data.size(), a_padding)` characters.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs, e.g. if the buffer is
+ * too small.
+ * @param[in] a_padding Should the string be padded at the end with the given padding character, if
+ * it's too short.
+ * @param[in] a_pad_character Character to use as padding.
+ *
+ * @returns std::size_t Number of characters written. 0 if an error occurred.
+ */
+auto base64_encode_into(
+    std::span<std::uint8_t const> a_data,
+    std::span<char> a_out,
+    std::error_code& a_ec,
+    bool a_padding = true,
+    char a_pad_character = '='
+)
+-> std::size_t;
+
+/**
+ * @brief Encodes the bytes at the start of a buffer as Base64 within the same buffer, expanding
+ * them from the back, so no second buffer is needed.
+ *
+ * @param[in][out] a_buffer Buffer holding the bytes to encode at its start, with room for the
+ * encoding - at least `base64_encoded_size(a_size, a_padding)` characters in total.
+ * @param[in] a_size Number of bytes to encode.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs, e.g. if the buffer is
+ * too small.
+ * @param[in] a_padding Should the string be padded at the end with the given padding character, if
+ * it's too short.
+ * @param[in] a_pad_character Character to use as padding.
+ *
+ * @returns std::size_t Number of characters written to the start of the buffer. 0 if an error
+ * occurred.
+ */
+auto base64_encode_inplace(
+    std::span<char> a_buffer,
+    std::size_t a_size,
+    std::error_code& a_ec,
+    bool a_padding = true,
+    char a_pad_character = '='
+)
+-> std::size_t;
+
 /**
  * @brief Encodes a vector of bytes as a Base64Url string.
  *
@@ -56,6 +163,54 @@ auto base64url_encode(
 )
 -> std::string;
 
+/**
+ * @brief Encodes bytes as a Base64Url string into a caller provided buffer, without allocating.
+ *
+ * @param[in] a_data Bytes to encode.
+ * @param[out] a_out Buffer to write the encoded string into. Has to hold at least
+ * `base64_encoded_size(a_data.size(), a_padding)` characters.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs, e.g. if the buffer is
+ * too small.
+ * @param[in] a_padding Should the string be padded at the end with the given padding character, if
+ * it's too short.
+ * @param[in] a_pad_character Character to use as padding.
+ *
+ * @returns std::size_t Number of characters written. 0 if an error occurred.
+ */
+auto base64url_encode_into(
+    std::span<std::uint8_t const> a_data,
+    std::span<char> a_out,
+    std::error_code& a_ec,
+    bool a_padding = false,
+    char a_pad_character = '='
+)
+-> std::size_t;
+
+/**
+ * @brief Encodes the bytes at the start of a buffer as Base64Url within the same buffer, expanding
+ * them from the back, so no second buffer is needed.
+ *
+ * @param[in][out] a_buffer Buffer holding the bytes to encode at its start, with room for the
+ * encoding - at least `base64_encoded_size(a_size, a_padding)` characters in total.
+ * @param[in] a_size Number of bytes to encode.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs, e.g. if the buffer is
+ * too small.
+ * @param[in] a_padding Should the string be padded at the end with the given padding character, if
+ * it's too short.
+ * @param[in] a_pad_character Character to use as padding.
+ *
+ * @returns std::size_t Number of characters written to the start of the buffer. 0 if an error
+ * occurred.
+ */
+auto base64url_encode_inplace(
+    std::span<char> a_buffer,
+    std::size_t a_size,
+    std::error_code& a_ec,
+    bool a_padding = false,
+    char a_pad_character = '='
+)
+-> std::size_t;
+
 /**
  * @brief Decodes a Base64 encoded string.
  *
@@ -76,6 +231,49 @@ auto base64_decode(
 )
 -> std::vector<std::uint8_t>;
 
+/**
+ * @brief Decodes a Base64 encoded string into a caller provided buffer, without allocating.
+ *
+ * @param[in] a_data Base64 encoded string to decode.
+ * @param[out] a_out Buffer to write the decoded bytes into. Has to hold at least
+ * `base64_decoded_size(a_data, a_pad_character)` bytes.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs, e.g. if the buffer is
+ * too small.
+ * @param[in] a_strict Enable/disable strict mode, see `base64_decode`.
+ * @param[in] a_pad_character Character to recognize as a padding character.
+ *
+ * @returns std::size_t Number of bytes written. 0 if an error occurred.
+ */
+auto base64_decode_into(
+    std::string_view const& a_data,
+    std::span<std::uint8_t> a_out,
+    std::error_code& a_ec,
+    bool a_strict = true,
+    char a_pad_character = '='
+)
+-> std::size_t;
+
+/**
+ * @brief Decodes a Base64 encoded buffer in place - the decoded bytes overwrite the buffer from
+ * its start, which is safe as the output never catches up with the input.
+ *
+ * @param[in][out] a_buffer Buffer holding the Base64 encoded string, which receives the decoded
+ * bytes.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs.
+ * @param[in] a_strict Enable/disable strict mode, see `base64_decode`.
+ * @param[in] a_pad_character Character to recognize as a padding character.
+ *
+ * @returns std::size_t Number of bytes decoded to the start of the buffer. 0 if an error occurred,
+ * in which case the buffer contents are unspecified.
+ */
+auto base64_decode_inplace(
+    std::span<char> a_buffer,
+    std::error_code& a_ec,
+    bool a_strict = true,
+    char a_pad_character = '='
+)
+-> std::size_t;
+
 /**
  * @brief Decodes a Base64Url encoded string.
  *
@@ -97,7 +295,51 @@ auto base64url_decode(
 -> std::vector<std::uint8_t>;
 
 /**
- * @brief Checks if the string contains invalid Base64 characters.
+ * @brief Decodes a Base64Url encoded string into a caller provided buffer, without allocating.
+ *
+ * @param[in] a_data Base64Url encoded string to decode.
+ * @param[out] a_out Buffer to write the decoded bytes into. Has to hold at least
+ * `base64_decoded_size(a_data, a_pad_character)` bytes.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs, e.g. if the buffer is
+ * too small.
+ * @param[in] a_strict Enable/disable strict mode, see `base64url_decode`.
+ * @param[in] a_pad_character Character to recognize as a padding character.
+ *
+ * @returns std::size_t Number of bytes written. 0 if an error occurred.
+ */
+auto base64url_decode_into(
+    std::string_view const& a_data,
+    std::span<std::uint8_t> a_out,
+    std::error_code& a_ec,
+    bool a_strict = true,
+    char a_pad_character = '='
+)
+-> std::size_t;
+
+/**
+ * @brief Decodes a Base64Url encoded buffer in place - the decoded bytes overwrite the buffer from
+ * its start, which is safe as the output never catches up with the input.
+ *
+ * @param[in][out] a_buffer Buffer holding the Base64Url encoded string, which receives the decoded
+ * bytes.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs.
+ * @param[in] a_strict Enable/disable strict mode, see `base64url_decode`.
+ * @param[in] a_pad_character Character to recognize as a padding character.
+ *
+ * @returns std::size_t Number of bytes decoded to the start of the buffer. 0 if an error occurred,
+ * in which case the buffer contents are unspecified.
+ */
+auto base64url_decode_inplace(
+    std::span<char> a_buffer,
+    std::error_code& a_ec,
+    bool a_strict = true,
+    char a_pad_character = '='
+)
+-> std::size_t;
+
+/**
+ * @brief Checks if the string is valid Base64 - only alphabet characters, followed by as much
+ * padding as the last block needs (or none at all), and a length a Base64 encoder can produce.
  *
  * @param[in] a_data String to check for conformance.
  * @param[in] a_pad_character Character to recognize as a padding character.
@@ -112,7 +354,26 @@ auto is_base64(
 -> bool;
 
 /**
- * @brief Checks if the string contains invalid Base64Url characters.
+ * @brief Checks if the string is valid Base64 and reports where the first problem is.
+ *
+ * @param[in] a_data String to check for conformance.
+ * @param[out] a_error Set to the offset and value of the first invalid character, when the
+ * function returns false.
+ * @param[in] a_pad_character Character to recognize as a padding character.
+ *
+ * @returns true If the string is possibly Base64 encoded.
+ * @returns false If the string can't be Base64 encoded, or at least not strictly.
+ */
+auto is_base64(
+    std::string_view const& a_data,
+    validation_error& a_error,
+    char a_pad_character = '='
+)
+-> bool;
+
+/**
+ * @brief Checks if the string is valid Base64Url - only alphabet characters, followed by as much
+ * padding as the last block needs (or none at all), and a length a Base64Url encoder can produce.
  *
  * @param[in] a_data String to check for conformance.
  * @param[in] a_pad_character Character to recognize as a padding character.
@@ -126,6 +387,957 @@ auto is_base64url(
 )
 -> bool;
 
+/**
+ * @brief Checks if the string is valid Base64Url and reports where the first problem is.
+ *
+ * @param[in] a_data String to check for conformance.
+ * @param[out] a_error Set to the offset and value of the first invalid character, when the
+ * function returns false.
+ * @param[in] a_pad_character Character to recognize as a padding character.
+ *
+ * @returns true If the string is possibly Base64Url encoded.
+ * @returns false If the string can't be Base64Url encoded, or at least not strictly.
+ */
+auto is_base64url(
+    std::string_view const& a_data,
+    validation_error& a_error,
+    char a_pad_character = '='
+)
+-> bool;
+
+/**
+ * @brief Encodes any contiguous range of bytes (`std::string`, `std::span<std::byte const>`,
+ * `std::array`, ...) as a Base64 string, without copying it into a vector first. Note that a
+ * string literal passed directly includes its terminating null.
+ *
+ * @param[in] a_data Bytes to encode.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs.
+ * @param[in] a_padding Should the string be padded at the end with the given padding character, if
+ * it's too short.
+ * @param[in] a_pad_character Character to use as padding.
+ *
+ * @returns std::string The encoded string. Empty if an error occurred.
+ */
+template <byte_range Range>
+auto base64_encode(
+    Range const& a_data,
+    std::error_code& a_ec,
+    bool a_padding = true,
+    char a_pad_character = '='
+)
+-> std::string
+{
+    std::string ret(base64_encoded_size(std::ranges::size(a_data), a_padding), '\0');
+    base64_encode_into(detail::as_byte_span(a_data), ret, a_ec, a_padding, a_pad_character);
+    return ret;
+}
+
+/**
+ * @brief Encodes any contiguous range of bytes as a Base64 string into any contiguous, writable
+ * range of characters.
+ *
+ * @returns std::size_t Number of characters written. 0 if an error occurred.
+ */
+template <byte_range Range, byte_range Output>
+auto base64_encode_into(
+    Range const& a_data,
+    Output&& a_out,
+    std::error_code& a_ec,
+    bool a_padding = true,
+    char a_pad_character = '='
+)
+-> std::size_t
+{
+    return base64_encode_into(
+        detail::as_byte_span(a_data),
+        detail::as_writable_char_span(a_out),
+        a_ec,
+        a_padding,
+        a_pad_character
+    );
+}
+
+/**
+ * @brief Decodes a Base64 encoded string directly into the given container type, e.g.
+ * `base64_decode<std::string>(data, ec)`.
+ *
+ * @param[in] a_data Base64 encoded string to decode.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs.
+ * @param[in] a_strict Enable/disable strict mode, see `base64_decode`.
+ * @param[in] a_pad_character Character to recognize as a padding character.
+ *
+ * @returns Container Byte representation of the decoded string.
+ */
+template <byte_container Container>
+auto base64_decode(
+    std::string_view const& a_data,
+    std::error_code& a_ec,
+    bool a_strict = true,
+    char a_pad_character = '='
+)
+-> Container
+{
+    Container ret;
+    ret.resize(base64_decoded_size(a_data, a_pad_character));
+    ret.resize(
+        base64_decode_into(
+            a_data,
+            detail::as_writable_byte_span(ret),
+            a_ec,
+            a_strict,
+            a_pad_character
+        )
+    );
+    return ret;
+}
+
+/**
+ * @brief Decodes a Base64 encoded string into any contiguous, writable range of bytes.
+ *
+ * @returns std::size_t Number of bytes written. 0 if an error occurred.
+ */
+template <byte_range Output>
+auto base64_decode_into(
+    std::string_view const& a_data,
+    Output&& a_out,
+    std::error_code& a_ec,
+    bool a_strict = true,
+    char a_pad_character = '='
+)
+-> std::size_t
+{
+    return base64_decode_into(
+        a_data,
+        detail::as_writable_byte_span(a_out),
+        a_ec,
+        a_strict,
+        a_pad_character
+    );
+}
+
+/**
+ * @brief Encodes any contiguous range of bytes (`std::string`, `std::span<std::byte const>`,
+ * `std::array`, ...) as a Base64Url string, without copying it into a vector first. Note that a
+ * string literal passed directly includes its terminating null.
+ *
+ * @param[in] a_data Bytes to encode.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs.
+ * @param[in] a_padding Should the string be padded at the end with the given padding character, if
+ * it's too short.
+ * @param[in] a_pad_character Character to use as padding.
+ *
+ * @returns std::string The encoded string. Empty if an error occurred.
+ */
+template <byte_range Range>
+auto base64url_encode(
+    Range const& a_data,
+    std::error_code& a_ec,
+    bool a_padding = false,
+    char a_pad_character = '='
+)
+-> std::string
+{
+    std::string ret(base64_encoded_size(std::ranges::size(a_data), a_padding), '\0');
+    base64url_encode_into(detail::as_byte_span(a_data), ret, a_ec, a_padding, a_pad_character);
+    return ret;
+}
+
+/**
+ * @brief Encodes any contiguous range of bytes as a Base64Url string into any contiguous, writable
+ * range of characters.
+ *
+ * @returns std::size_t Number of characters written. 0 if an error occurred.
+ */
+template <byte_range Range, byte_range Output>
+auto base64url_encode_into(
+    Range const& a_data,
+    Output&& a_out,
+    std::error_code& a_ec,
+    bool a_padding = false,
+    char a_pad_character = '='
+)
+-> std::size_t
+{
+    return base64url_encode_into(
+        detail::as_byte_span(a_data),
+        detail::as_writable_char_span(a_out),
+        a_ec,
+        a_padding,
+        a_pad_character
+    );
+}
+
+/**
+ * @brief Decodes a Base64Url encoded string directly into the given container type, e.g.
+ * `base64url_decode<std::string>(data, ec)`.
+ *
+ * @param[in] a_data Base64Url encoded string to decode.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs.
+ * @param[in] a_strict Enable/disable strict mode, see `base64url_decode`.
+ * @param[in] a_pad_character Character to recognize as a padding character.
+ *
+ * @returns Container Byte representation of the decoded string.
+ */
+template <byte_container Container>
+auto base64url_decode(
+    std::string_view const& a_data,
+    std::error_code& a_ec,
+    bool a_strict = true,
+    char a_pad_character = '='
+)
+-> Container
+{
+    Container ret;
+    ret.resize(base64_decoded_size(a_data, a_pad_character));
+    ret.resize(
+        base64url_decode_into(
+            a_data,
+            detail::as_writable_byte_span(ret),
+            a_ec,
+            a_strict,
+            a_pad_character
+        )
+    );
+    return ret;
+}
+
+/**
+ * @brief Decodes a Base64Url encoded string into any contiguous, writable range of bytes.
+ *
+ * @returns std::size_t Number of bytes written. 0 if an error occurred.
+ */
+template <byte_range Output>
+auto base64url_decode_into(
+    std::string_view const& a_data,
+    Output&& a_out,
+    std::error_code& a_ec,
+    bool a_strict = true,
+    char a_pad_character = '='
+)
+-> std::size_t
+{
+    return base64url_decode_into(
+        a_data,
+        detail::as_writable_byte_span(a_out),
+        a_ec,
+        a_strict,
+        a_pad_character
+    );
+}
+
+/**
+ * @brief Appends the Base64 encoding of the data to an existing string, growing it only once.
+ *
+ * @param[in] a_data Bytes to encode.
+ * @param[in][out] a_out String to append the encoded data to.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs.
+ * @param[in] a_padding Should the string be padded at the end with the given padding character, if
+ * it's too short.
+ * @param[in] a_pad_character Character to use as padding.
+ *
+ * @returns std::size_t Number of characters appended.
+ */
+template <byte_range Range>
+auto base64_encode_append(
+    Range const& a_data,
+    std::string& a_out,
+    std::error_code& a_ec,
+    bool a_padding = true,
+    char a_pad_character = '='
+)
+-> std::size_t
+{
+    auto const offset = a_out.size();
+    a_out.resize(offset + base64_encoded_size(std::ranges::size(a_data), a_padding));
+
+    auto const written = base64_encode_into(
+        detail::as_byte_span(a_data),
+        std::span<char>(a_out).subspan(offset),
+        a_ec,
+        a_padding,
+        a_pad_character
+    );
+
+    a_out.resize(offset + written);
+    return written;
+}
+
+/**
+ * @brief Encodes the data as Base64 and hands it to the callback in chunks, as
+ * `std::string_view`s that are only valid for the duration of the call. Nothing gets allocated.
+ *
+ * @param[in] a_data Bytes to encode.
+ * @param[in] a_callback Callable taking a `std::string_view` of encoded characters.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs.
+ * @param[in] a_padding Should the string be padded at the end with the given padding character, if
+ * it's too short.
+ * @param[in] a_pad_character Character to use as padding.
+ */
+template <byte_range Range, std::invocable<std::string_view> Callback>
+auto base64_encode_to(
+    Range const& a_data,
+    Callback&& a_callback,
+    std::error_code& a_ec,
+    bool a_padding = true,
+    char a_pad_character = '='
+)
+-> void
+{
+    detail::encode_in_chunks<3, 4>(
+        detail::as_byte_span(a_data),
+        a_ec,
+        [&](
+            std::span<std::uint8_t const> a_chunk,
+            std::span<char> a_buffer,
+            std::error_code& a_chunk_ec
+        )
+        {
+            return base64_encode_into(a_chunk, a_buffer, a_chunk_ec, a_padding, a_pad_character);
+        },
+        a_callback
+    );
+}
+
+/**
+ * @brief Encodes the data as Base64 into an output iterator, e.g. a `std::back_inserter` or a
+ * `std::ostreambuf_iterator`.
+ *
+ * @param[in] a_data Bytes to encode.
+ * @param[in] a_out Iterator to write the encoded characters to.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs.
+ * @param[in] a_padding Should the string be padded at the end with the given padding character, if
+ * it's too short.
+ * @param[in] a_pad_character Character to use as padding.
+ *
+ * @returns OutputIt The iterator past the last character written.
+ */
+template <byte_range Range, std::output_iterator<char> OutputIt>
+auto base64_encode_to(
+    Range const& a_data,
+    OutputIt a_out,
+    std::error_code& a_ec,
+    bool a_padding = true,
+    char a_pad_character = '='
+)
+-> OutputIt
+{
+    base64_encode_to(
+        a_data,
+        [&](std::string_view a_chunk) { a_out = std::copy(a_chunk.begin(), a_chunk.end(), a_out); },
+        a_ec,
+        a_padding,
+        a_pad_character
+    );
+
+    return a_out;
+}
+
+/**
+ * @brief Appends the Base64Url encoding of the data to an existing string, growing it only once.
+ *
+ * @param[in] a_data Bytes to encode.
+ * @param[in][out] a_out String to append the encoded data to.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs.
+ * @param[in] a_padding Should the string be padded at the end with the given padding character, if
+ * it's too short.
+ * @param[in] a_pad_character Character to use as padding.
+ *
+ * @returns std::size_t Number of characters appended.
+ */
+template <byte_range Range>
+auto base64url_encode_append(
+    Range const& a_data,
+    std::string& a_out,
+    std::error_code& a_ec,
+    bool a_padding = false,
+    char a_pad_character = '='
+)
+-> std::size_t
+{
+    auto const offset = a_out.size();
+    a_out.resize(offset + base64_encoded_size(std::ranges::size(a_data), a_padding));
+
+    auto const written = base64url_encode_into(
+        detail::as_byte_span(a_data),
+        std::span<char>(a_out).subspan(offset),
+        a_ec,
+        a_padding,
+        a_pad_character
+    );
+
+    a_out.resize(offset + written);
+    return written;
+}
+
+/**
+ * @brief Encodes the data as Base64Url and hands it to the callback in chunks, as
+ * `std::string_view`s that are only valid for the duration of the call. Nothing gets allocated.
+ *
+ * @param[in] a_data Bytes to encode.
+ * @param[in] a_callback Callable taking a `std::string_view` of encoded characters.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs.
+ * @param[in] a_padding Should the string be padded at the end with the given padding character, if
+ * it's too short.
+ * @param[in] a_pad_character Character to use as padding.
+ */
+template <byte_range Range, std::invocable<std::string_view> Callback>
+auto base64url_encode_to(
+    Range const& a_data,
+    Callback&& a_callback,
+    std::error_code& a_ec,
+    bool a_padding = false,
+    char a_pad_character = '='
+)
+-> void
+{
+    detail::encode_in_chunks<3, 4>(
+        detail::as_byte_span(a_data),
+        a_ec,
+        [&](
+            std::span<std::uint8_t const> a_chunk,
+            std::span<char> a_buffer,
+            std::error_code& a_chunk_ec
+        )
+        {
+            return base64url_encode_into(a_chunk, a_buffer, a_chunk_ec, a_padding, a_pad_character);
+        },
+        a_callback
+    );
+}
+
+/**
+ * @brief Encodes the data as Base64Url into an output iterator, e.g. a `std::back_inserter` or a
+ * `std::ostreambuf_iterator`.
+ *
+ * @param[in] a_data Bytes to encode.
+ * @param[in] a_out Iterator to write the encoded characters to.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs.
+ * @param[in] a_padding Should the string be padded at the end with the given padding character, if
+ * it's too short.
+ * @param[in] a_pad_character Character to use as padding.
+ *
+ * @returns OutputIt The iterator past the last character written.
+ */
+template <byte_range Range, std::output_iterator<char> OutputIt>
+auto base64url_encode_to(
+    Range const& a_data,
+    OutputIt a_out,
+    std::error_code& a_ec,
+    bool a_padding = false,
+    char a_pad_character = '='
+)
+-> OutputIt
+{
+    base64url_encode_to(
+        a_data,
+        [&](std::string_view a_chunk) { a_out = std::copy(a_chunk.begin(), a_chunk.end(), a_out); },
+        a_ec,
+        a_padding,
+        a_pad_character
+    );
+
+    return a_out;
+}
+
+/**
+ * @brief Encodes any contiguous range of bytes as a Base64 string allocated from the given memory
+ * resource.
+ *
+ * @param[in] a_data Bytes to encode.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs.
+ * @param[in] a_resource Memory resource to allocate the string from, e.g. a per request arena or
+ * a `huge_page_resource`.
+ * @param[in] a_padding Should the string be padded at the end with the given padding character, if
+ * it's too short.
+ * @param[in] a_pad_character Character to use as padding.
+ *
+ * @returns std::pmr::string The encoded string. Empty if an error occurred.
+ */
+template <byte_range Range>
+auto base64_encode(
+    Range const& a_data,
+    std::error_code& a_ec,
+    std::pmr::memory_resource* a_resource,
+    bool a_padding = true,
+    char a_pad_character = '='
+)
+-> std::pmr::string
+{
+    std::pmr::string ret(
+        base64_encoded_size(std::ranges::size(a_data), a_padding),
+        '\0',
+        a_resource
+    );
+    base64_encode_into(detail::as_byte_span(a_data), ret, a_ec, a_padding, a_pad_character);
+    return ret;
+}
+
+/**
+ * @brief Decodes a Base64 encoded string into a vector allocated from the given memory resource.
+ *
+ * @param[in] a_data Base64 encoded string to decode.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs.
+ * @param[in] a_resource Memory resource to allocate the vector from.
+ * @param[in] a_strict Enable/disable strict mode, see `base64_decode`.
+ * @param[in] a_pad_character Character to recognize as a padding character.
+ *
+ * @returns std::pmr::vector<std::uint8_t> Byte representation of the decoded string.
+ */
+inline auto base64_decode(
+    std::string_view const& a_data,
+    std::error_code& a_ec,
+    std::pmr::memory_resource* a_resource,
+    bool a_strict = true,
+    char a_pad_character = '='
+)
+-> std::pmr::vector<std::uint8_t>
+{
+    std::pmr::vector<std::uint8_t> ret(base64_decoded_size(a_data, a_pad_character), a_resource);
+    ret.resize(base64_decode_into(
+        a_data,
+        std::span<std::uint8_t>(ret),
+        a_ec,
+        a_strict,
+        a_pad_character
+    ));
+    return ret;
+}
+
+/**
+ * @brief Encodes any contiguous range of bytes as a Base64Url string allocated from the given
+ * memory resource.
+ *
+ * @param[in] a_data Bytes to encode.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs.
+ * @param[in] a_resource Memory resource to allocate the string from, e.g. a per request arena or
+ * a `huge_page_resource`.
+ * @param[in] a_padding Should the string be padded at the end with the given padding character, if
+ * it's too short.
+ * @param[in] a_pad_character Character to use as padding.
+ *
+ * @returns std::pmr::string The encoded string. Empty if an error occurred.
+ */
+template <byte_range Range>
+auto base64url_encode(
+    Range const& a_data,
+    std::error_code& a_ec,
+    std::pmr::memory_resource* a_resource,
+    bool a_padding = false,
+    char a_pad_character = '='
+)
+-> std::pmr::string
+{
+    std::pmr::string ret(
+        base64_encoded_size(std::ranges::size(a_data), a_padding),
+        '\0',
+        a_resource
+    );
+    base64url_encode_into(detail::as_byte_span(a_data), ret, a_ec, a_padding, a_pad_character);
+    return ret;
+}
+
+/**
+ * @brief Decodes a Base64Url encoded string into a vector allocated from the given memory resource.
+ *
+ * @param[in] a_data Base64Url encoded string to decode.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs.
+ * @param[in] a_resource Memory resource to allocate the vector from.
+ * @param[in] a_strict Enable/disable strict mode, see `base64url_decode`.
+ * @param[in] a_pad_character Character to recognize as a padding character.
+ *
+ * @returns std::pmr::vector<std::uint8_t> Byte representation of the decoded string.
+ */
+inline auto base64url_decode(
+    std::string_view const& a_data,
+    std::error_code& a_ec,
+    std::pmr::memory_resource* a_resource,
+    bool a_strict = true,
+    char a_pad_character = '='
+)
+-> std::pmr::vector<std::uint8_t>
+{
+    std::pmr::vector<std::uint8_t> ret(base64_decoded_size(a_data, a_pad_character), a_resource);
+    ret.resize(base64url_decode_into(
+        a_data,
+        std::span<std::uint8_t>(ret),
+        a_ec,
+        a_strict,
+        a_pad_character
+    ));
+    return ret;
+}
+
+/**
+ * @brief Encodes a stream of bytes as Base64 one chunk at a time, in constant memory.
+ *
+ * Chunks can be split anywhere - the bytes of a trailing partial block are held back until the
+ * next chunk arrives, and whole blocks go through the same kernels as `base64_encode`. `finish()`
+ * writes the last partial block and its padding, after which the encoder is ready for a new
+ * stream.
+ */
+class base64_encoder
+{
+public:
+    /**
+     * @param[in] a_padding Should the stream be padded at the end with the given padding
+     * character, if it's too short.
+     * @param[in] a_pad_character Character to use as padding.
+     */
+    explicit base64_encoder(
+        bool a_padding = true,
+        char a_pad_character = '='
+    );
+
+    /**
+     * @brief Returns the most characters `update()` can write for a chunk of the given size.
+     */
+    auto max_update_size(std::size_t a_size) const -> std::size_t;
+
+    /**
+     * @brief Returns the most characters `finish()` can write.
+     */
+    static constexpr auto max_finish_size() -> std::size_t
+    {
+        return 4;
+    }
+
+    /**
+     * @brief Encodes the next chunk of the stream.
+     *
+     * @param[in] a_data Next chunk of bytes.
+     * @param[out] a_out Buffer of at least `max_update_size(a_data.size())` characters.
+     * @param[in][out] a_ec std::error_code that gets set if the buffer is too small.
+     *
+     * @returns std::size_t Number of characters written.
+     */
+    auto update(
+        std::span<std::uint8_t const> a_data,
+        std::span<char> a_out,
+        std::error_code& a_ec
+    )
+    -> std::size_t;
+
+    /**
+     * @brief Encodes the next chunk of the stream, appending it to a string.
+     */
+    template <byte_range Range, typename Traits, typename Allocator>
+    auto update(
+        Range const& a_data,
+        std::basic_string<char, Traits, Allocator>& a_out,
+        std::error_code& a_ec
+    )
+    -> void
+    {
+        auto const offset = a_out.size();
+        a_out.resize(offset + max_update_size(std::ranges::size(a_data)));
+        a_out.resize(offset + update(
+            detail::as_byte_span(a_data),
+            std::span<char>(a_out).subspan(offset),
+            a_ec
+        ));
+    }
+
+    /**
+     * @brief Ends the stream, writing the last partial block and the padding.
+     *
+     * @param[out] a_out Buffer of at least `max_finish_size()` characters.
+     * @param[in][out] a_ec std::error_code that gets set if the buffer is too small.
+     *
+     * @returns std::size_t Number of characters written.
+     */
+    auto finish(
+        std::span<char> a_out,
+        std::error_code& a_ec
+    )
+    -> std::size_t;
+
+    /**
+     * @brief Ends the stream, appending the last partial block and the padding to a string.
+     */
+    template <typename Traits, typename Allocator>
+    auto finish(
+        std::basic_string<char, Traits, Allocator>& a_out,
+        std::error_code& a_ec
+    )
+    -> void
+    {
+        auto const offset = a_out.size();
+        a_out.resize(offset + max_finish_size());
+        a_out.resize(offset + finish(std::span<char>(a_out).subspan(offset), a_ec));
+    }
+
+protected:
+    base64_encoder(
+        bool a_url,
+        bool a_padding,
+        char a_pad_character
+    );
+
+private:
+    bool m_url;
+    bool m_padding;
+    char m_pad_character;
+    detail::encoder_state m_state;
+};
+
+/**
+ * @brief Encodes a stream of bytes as Base64Url one chunk at a time, see `base64_encoder`.
+ */
+class base64url_encoder : public base64_encoder
+{
+public:
+    explicit base64url_encoder(
+        bool a_padding = false,
+        char a_pad_character = '='
+    );
+};
+
+/**
+ * @brief Decodes a Base64 stream one chunk at a time, in constant memory.
+ *
+ * Chunks can be split anywhere - the bits of a partial byte are carried over to the next chunk,
+ * and whole blocks go through the same kernels as `base64_decode`. Everything after the first
+ * padding character is ignored. After an error the stream can't be continued, only ended with
+ * `finish()`, which also gets the decoder ready for a new stream.
+ */
+class base64_decoder
+{
+public:
+    /**
+     * @param[in] a_strict Enable/disable strict mode, see `base64_decode`.
+     * @param[in] a_pad_character Character to recognize as a padding character.
+     */
+    explicit base64_decoder(
+        bool a_strict = true,
+        char a_pad_character = '='
+    );
+
+    /**
+     * @brief Returns the most bytes `update()` can write for a chunk of the given size.
+     */
+    auto max_update_size(std::size_t a_size) const -> std::size_t;
+
+    /**
+     * @brief Decodes the next chunk of the stream.
+     *
+     * @param[in] a_data Next chunk of Base64 characters.
+     * @param[out] a_out Buffer of at least `max_update_size(a_data.size())` bytes.
+     * @param[in][out] a_ec std::error_code that gets set if a problem occurs.
+     *
+     * @returns std::size_t Number of bytes written. 0 if an error occurred.
+     */
+    auto update(
+        std::string_view const& a_data,
+        std::span<std::uint8_t> a_out,
+        std::error_code& a_ec
+    )
+    -> std::size_t;
+
+    /**
+     * @brief Decodes the next chunk of the stream, appending it to a byte container.
+     */
+    template <byte_container Container>
+    auto update(
+        std::string_view const& a_data,
+        Container& a_out,
+        std::error_code& a_ec
+    )
+    -> void
+    {
+        auto const offset = std::ranges::size(a_out);
+        a_out.resize(offset + max_update_size(a_data.size()));
+        a_out.resize(offset + update(
+            a_data,
+            detail::as_writable_byte_span(a_out).subspan(offset),
+            a_ec
+        ));
+    }
+
+    /**
+     * @brief Ends the stream and gets the decoder ready for a new one.
+     *
+     * @param[in][out] a_ec std::error_code, kept for symmetry with `base16_decoder` - like
+     * `base64_decode`, a stream may end anywhere.
+     */
+    auto finish(std::error_code& a_ec) -> void;
+
+protected:
+    base64_decoder(
+        bool a_url,
+        bool a_strict,
+        char a_pad_character
+    );
+
+private:
+    bool m_url;
+    bool m_strict;
+    char m_pad_character;
+    detail::decoder_state m_state;
+};
+
+/**
+ * @brief Decodes a Base64Url stream one chunk at a time, see `base64_decoder`.
+ */
+class base64url_decoder : public base64_decoder
+{
+public:
+    explicit base64url_decoder(
+        bool a_strict = true,
+        char a_pad_character = '='
+    );
+};
+
+/**
+ * @brief Encodes a constant as Base64 at compile time.
+ *
+ * @tparam Padding Should the encoding be padded with '=' characters.
+ * @param[in] a_data Bytes to encode.
+ *
+ * @returns std::array<char, N> Encoded characters, without a terminating null character.
+ */
+template <bool Padding = true, std::size_t Size>
+consteval auto base64_encode_constant(std::array<std::uint8_t, Size> const& a_data)
+-> std::array<char, detail::constant_encoded_size<base64_alphabet, Padding>(Size)>
+{
+    return detail::encode_constant<base64_alphabet, Padding>(a_data);
+}
+
+/**
+ * @brief Decodes a Base64 constant at compile time, e.g. `base64_decode_constant<"Zm9v">()`.
+ * Input that `base64_decode` would reject in strict mode doesn't compile.
+ *
+ * @returns std::array<std::uint8_t, N> Decoded bytes.
+ */
+template <fixed_string Encoded>
+consteval auto base64_decode_constant()
+-> std::array<std::uint8_t, detail::constant_symbols<base64_alphabet>(Encoded.view()) * 6 / 8>
+{
+    return detail::decode_constant<base64_alphabet, Encoded>();
+}
+
+/**
+ * @brief Encodes a constant as Base64Url at compile time.
+ *
+ * @tparam Padding Should the encoding be padded with '=' characters.
+ * @param[in] a_data Bytes to encode.
+ *
+ * @returns std::array<char, N> Encoded characters, without a terminating null character.
+ */
+template <bool Padding = false, std::size_t Size>
+consteval auto base64url_encode_constant(std::array<std::uint8_t, Size> const& a_data)
+-> std::array<char, detail::constant_encoded_size<base64url_alphabet, Padding>(Size)>
+{
+    return detail::encode_constant<base64url_alphabet, Padding>(a_data);
+}
+
+/**
+ * @brief Decodes a Base64Url constant at compile time, e.g. `base64url_decode_constant<"Zm9v">()`.
+ * Input that `base64url_decode` would reject in strict mode doesn't compile.
+ *
+ * @returns std::array<std::uint8_t, N> Decoded bytes.
+ */
+template <fixed_string Encoded>
+consteval auto base64url_decode_constant()
+-> std::array<std::uint8_t, detail::constant_symbols<base64url_alphabet>(Encoded.view()) * 6 / 8>
+{
+    return detail::decode_constant<base64url_alphabet, Encoded>();
+}
+
+/**
+ * @brief Encodes a fixed size input (a digest, UUID or key) as Base64 with fully unrolled code.
+ *
+ * @tparam Padding Should the encoding be padded with '=' characters.
+ * @param[in] a_data Bytes to encode.
+ *
+ * @returns std::array<char, N> Encoded characters, without a terminating null character.
+ */
+template <bool Padding = true, std::size_t Size>
+constexpr auto base64_encode_fixed(std::array<std::uint8_t, Size> const& a_data)
+-> std::array<char, base64_encoded_size(Size, Padding)>
+{
+    return detail::encode_fixed<base64_alphabet, Padding>(a_data);
+}
+
+/**
+ * @brief Decodes the Base64 encoding of a fixed size value with fully unrolled code.
+ *
+ * @tparam Size Number of bytes to decode, e.g. `base64_decode_fixed<32>(key, ec)`.
+ * @tparam Padding Is the input padded with '=' characters.
+ * @param[in] a_data Base64 encoding of exactly `Size` bytes.
+ * @param[in][out] a_ec std::error_code that gets set if the input has the wrong length or holds
+ * any character outside the alphabet.
+ *
+ * @returns std::array<std::uint8_t, Size> Decoded bytes. All zero if an error occurred.
+ */
+template <std::size_t Size, bool Padding = true>
+constexpr auto base64_decode_fixed(
+    std::string_view const& a_data,
+    std::error_code& a_ec
+)
+-> std::array<std::uint8_t, Size>
+{
+    return detail::decode_fixed<base64_alphabet, Padding, Size>(a_data, a_ec);
+}
+
+/**
+ * @brief Encodes a fixed size input (a digest, UUID or key) as Base64Url with fully unrolled code.
+ *
+ * @tparam Padding Should the encoding be padded with '=' characters.
+ * @param[in] a_data Bytes to encode.
+ *
+ * @returns std::array<char, N> Encoded characters, without a terminating null character.
+ */
+template <bool Padding = false, std::size_t Size>
+constexpr auto base64url_encode_fixed(std::array<std::uint8_t, Size> const& a_data)
+-> std::array<char, base64_encoded_size(Size, Padding)>
+{
+    return detail::encode_fixed<base64url_alphabet, Padding>(a_data);
+}
+
+/**
+ * @brief Decodes the Base64Url encoding of a fixed size value with fully unrolled code.
+ *
+ * @tparam Size Number of bytes to decode, e.g. `base64url_decode_fixed<32>(key, ec)`.
+ * @tparam Padding Is the input padded with '=' characters.
+ * @param[in] a_data Base64Url encoding of exactly `Size` bytes.
+ * @param[in][out] a_ec std::error_code that gets set if the input has the wrong length or holds
+ * any character outside the alphabet.
+ *
+ * @returns std::array<std::uint8_t, Size> Decoded bytes. All zero if an error occurred.
+ */
+template <std::size_t Size, bool Padding = false>
+constexpr auto base64url_decode_fixed(
+    std::string_view const& a_data,
+    std::error_code& a_ec
+)
+-> std::array<std::uint8_t, Size>
+{
+    return detail::decode_fixed<base64url_alphabet, Padding, Size>(a_data, a_ec);
+}
+
+namespace literals
+{
+
+/**
+ * @brief Decodes a Base64 literal at compile time, e.g. `"Zm9v"_b64`.
+ */
+template <fixed_string Encoded>
+consteval auto operator""_b64()
+{
+    return base64_decode_constant<Encoded>();
+}
+
+/**
+ * @brief Decodes a Base64Url literal at compile time, e.g. `"Zm9v"_b64url`.
+ */
+template <fixed_string Encoded>
+consteval auto operator""_b64url()
+{
+    return base64url_decode_constant<Encoded>();
+}
+
+}   // namespace literals
+
 }   // namespace base_codec
 }   // namespace rs
 
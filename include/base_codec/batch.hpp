@@ -0,0 +1,557 @@
+/**
+ * @file batch.hpp
+ *
+ * Encoding and decoding of whole columns of values laid out like Apache Arrow binary arrays: one
+ * contiguous data buffer plus `n + 1` offsets, value `i` being `data[offsets[i], offsets[i + 1])`.
+ * The output column is sized in a first pass over the offsets and allocated once, then every value
+ * is transcoded straight into it without any per value call or allocation overhead.
+ *
+ * Columns of equal sized items (session IDs, digests, MACs) don't need offsets at all, and get
+ * encoded many items at a time with every SIMD lane working on a different item.
+ */
+#pragma once
+
+#include <base_codec/alphabet.hpp>
+#include <base_codec/byte_range.hpp>
+
+#include <concepts>
+#include <memory_resource>
+#include <ranges>
+#include <span>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+
+
+namespace rs
+{
+namespace base_codec
+{
+
+/**
+ * @brief Arrow offset types - `std::int32_t` for `binary` / `utf8` columns and `std::int64_t`
+ * for `large_binary` / `large_utf8` ones.
+ */
+template <typename Offset>
+concept batch_offset = std::same_as<Offset, std::int32_t> || std::same_as<Offset, std::int64_t>;
+
+/**
+ * @brief Contiguous range of Arrow offsets.
+ */
+template <typename Range>
+concept offset_range = std::ranges::contiguous_range<Range> &&
+                       std::ranges::sized_range<Range> &&
+                       batch_offset<std::ranges::range_value_t<Range>>;
+
+/**
+ * @brief Column of encoded values, its offsets starting at 0.
+ */
+template <batch_offset Offset>
+struct encoded_batch
+{
+    std::pmr::string data;
+    std::pmr::vector<Offset> offsets;
+};
+
+/**
+ * @brief Column of decoded values, its offsets starting at 0.
+ */
+template <batch_offset Offset>
+struct decoded_batch
+{
+    std::pmr::vector<std::uint8_t> data;
+    std::pmr::vector<Offset> offsets;
+};
+
+namespace detail
+{
+
+// NOTE - Defined in src/batch.cpp for every alphabet and both offset types.
+template <typename Alphabet, batch_offset Offset>
+auto encode_batch(
+    std::span<std::uint8_t const> a_data,
+    std::span<Offset const> a_offsets,
+    std::error_code& a_ec,
+    std::pmr::memory_resource* a_resource,
+    bool a_padding,
+    char a_pad_character
+)
+-> encoded_batch<Offset>;
+
+template <typename Alphabet, batch_offset Offset>
+auto decode_batch(
+    std::span<char const> a_data,
+    std::span<Offset const> a_offsets,
+    std::error_code& a_ec,
+    std::pmr::memory_resource* a_resource,
+    bool a_strict,
+    char a_pad_character
+)
+-> decoded_batch<Offset>;
+
+// NOTE - Defined in src/batch.cpp for Base16, Base64 and Base64Url.
+template <typename Alphabet>
+auto encode_items(
+    std::span<std::uint8_t const> a_data,
+    std::size_t a_item_size,
+    std::error_code& a_ec,
+    std::pmr::memory_resource* a_resource,
+    bool a_padding,
+    char a_pad_character
+)
+-> std::pmr::string;
+
+template <offset_range Offsets>
+auto as_offset_span(Offsets const& a_offsets)
+-> std::span<std::ranges::range_value_t<Offsets> const>
+{
+    return {std::ranges::data(a_offsets), std::ranges::size(a_offsets)};
+}
+
+template <byte_range Range>
+auto as_char_span(Range const& a_range) -> std::span<char const>
+{
+    return {reinterpret_cast<char const*>(std::ranges::data(a_range)), std::ranges::size(a_range)};
+}
+
+}   // namespace detail
+
+/**
+ * @brief Encodes every value of a column as Base16.
+ *
+ * @param[in] a_data Data buffer of the column.
+ * @param[in] a_offsets The `n + 1` offsets of the `n` values into `a_data`.
+ * @param[in][out] a_ec std::error_code that gets set if the offsets aren't ascending and within
+ * `a_data`, or if the output doesn't fit the offset type.
+ * @param[in] a_resource Memory resource to allocate the output column from.
+ *
+ * @returns encoded_batch<Offset> The encoded column. Empty if an error occurred.
+ */
+template <byte_range Range, offset_range Offsets>
+auto base16_encode_batch(
+    Range const& a_data,
+    Offsets const& a_offsets,
+    std::error_code& a_ec,
+    std::pmr::memory_resource* a_resource = std::pmr::get_default_resource()
+)
+-> encoded_batch<std::ranges::range_value_t<Offsets>>
+{
+    return detail::encode_batch<base16_alphabet>(
+        detail::as_byte_span(a_data),
+        detail::as_offset_span(a_offsets),
+        a_ec,
+        a_resource,
+        false,
+        '\0'
+    );
+}
+
+/**
+ * @brief Decodes every value of a Base16 encoded column.
+ *
+ * @param[in] a_data Data buffer of the column.
+ * @param[in] a_offsets The `n + 1` offsets of the `n` values into `a_data`.
+ * @param[in][out] a_ec std::error_code that gets set if the offsets aren't ascending and within
+ * `a_data`, or if any value can't be decoded.
+ * @param[in] a_resource Memory resource to allocate the output column from.
+ * @param[in] a_strict Enable/disable strict mode, see `base16_decode`.
+ *
+ * @returns decoded_batch<Offset> The decoded column. Empty if an error occurred.
+ */
+template <byte_range Range, offset_range Offsets>
+auto base16_decode_batch(
+    Range const& a_data,
+    Offsets const& a_offsets,
+    std::error_code& a_ec,
+    std::pmr::memory_resource* a_resource = std::pmr::get_default_resource(),
+    bool a_strict = true
+)
+-> decoded_batch<std::ranges::range_value_t<Offsets>>
+{
+    return detail::decode_batch<base16_alphabet>(
+        detail::as_char_span(a_data),
+        detail::as_offset_span(a_offsets),
+        a_ec,
+        a_resource,
+        a_strict,
+        '\0'
+    );
+}
+
+/**
+ * @brief Encodes every value of a column as Base32.
+ *
+ * @param[in] a_data Data buffer of the column.
+ * @param[in] a_offsets The `n + 1` offsets of the `n` values into `a_data`.
+ * @param[in][out] a_ec std::error_code that gets set if the offsets aren't ascending and within
+ * `a_data`, or if the output doesn't fit the offset type.
+ * @param[in] a_resource Memory resource to allocate the output column from.
+ * @param[in] a_padding Should every value be padded with the given padding character.
+ * @param[in] a_pad_character Character to use as padding.
+ *
+ * @returns encoded_batch<Offset> The encoded column. Empty if an error occurred.
+ */
+template <byte_range Range, offset_range Offsets>
+auto base32_encode_batch(
+    Range const& a_data,
+    Offsets const& a_offsets,
+    std::error_code& a_ec,
+    std::pmr::memory_resource* a_resource = std::pmr::get_default_resource(),
+    bool a_padding = true,
+    char a_pad_character = '='
+)
+-> encoded_batch<std::ranges::range_value_t<Offsets>>
+{
+    return detail::encode_batch<base32_alphabet>(
+        detail::as_byte_span(a_data),
+        detail::as_offset_span(a_offsets),
+        a_ec,
+        a_resource,
+        a_padding,
+        a_pad_character
+    );
+}
+
+/**
+ * @brief Decodes every value of a Base32 encoded column.
+ *
+ * @param[in] a_data Data buffer of the column.
+ * @param[in] a_offsets The `n + 1` offsets of the `n` values into `a_data`.
+ * @param[in][out] a_ec std::error_code that gets set if the offsets aren't ascending and within
+ * `a_data`, or if any value can't be decoded.
+ * @param[in] a_resource Memory resource to allocate the output column from.
+ * @param[in] a_strict Enable/disable strict mode, see `base32_decode`.
+ * @param[in] a_pad_character Character to recognize as a padding character.
+ *
+ * @returns decoded_batch<Offset> The decoded column. Empty if an error occurred.
+ */
+template <byte_range Range, offset_range Offsets>
+auto base32_decode_batch(
+    Range const& a_data,
+    Offsets const& a_offsets,
+    std::error_code& a_ec,
+    std::pmr::memory_resource* a_resource = std::pmr::get_default_resource(),
+    bool a_strict = true,
+    char a_pad_character = '='
+)
+-> decoded_batch<std::ranges::range_value_t<Offsets>>
+{
+    return detail::decode_batch<base32_alphabet>(
+        detail::as_char_span(a_data),
+        detail::as_offset_span(a_offsets),
+        a_ec,
+        a_resource,
+        a_strict,
+        a_pad_character
+    );
+}
+
+/**
+ * @brief Encodes every value of a column as Base32Hex.
+ *
+ * @param[in] a_data Data buffer of the column.
+ * @param[in] a_offsets The `n + 1` offsets of the `n` values into `a_data`.
+ * @param[in][out] a_ec std::error_code that gets set if the offsets aren't ascending and within
+ * `a_data`, or if the output doesn't fit the offset type.
+ * @param[in] a_resource Memory resource to allocate the output column from.
+ * @param[in] a_padding Should every value be padded with the given padding character.
+ * @param[in] a_pad_character Character to use as padding.
+ *
+ * @returns encoded_batch<Offset> The encoded column. Empty if an error occurred.
+ */
+template <byte_range Range, offset_range Offsets>
+auto base32hex_encode_batch(
+    Range const& a_data,
+    Offsets const& a_offsets,
+    std::error_code& a_ec,
+    std::pmr::memory_resource* a_resource = std::pmr::get_default_resource(),
+    bool a_padding = true,
+    char a_pad_character = '='
+)
+-> encoded_batch<std::ranges::range_value_t<Offsets>>
+{
+    return detail::encode_batch<base32hex_alphabet>(
+        detail::as_byte_span(a_data),
+        detail::as_offset_span(a_offsets),
+        a_ec,
+        a_resource,
+        a_padding,
+        a_pad_character
+    );
+}
+
+/**
+ * @brief Decodes every value of a Base32Hex encoded column.
+ *
+ * @param[in] a_data Data buffer of the column.
+ * @param[in] a_offsets The `n + 1` offsets of the `n` values into `a_data`.
+ * @param[in][out] a_ec std::error_code that gets set if the offsets aren't ascending and within
+ * `a_data`, or if any value can't be decoded.
+ * @param[in] a_resource Memory resource to allocate the output column from.
+ * @param[in] a_strict Enable/disable strict mode, see `base32hex_decode`.
+ * @param[in] a_pad_character Character to recognize as a padding character.
+ *
+ * @returns decoded_batch<Offset> The decoded column. Empty if an error occurred.
+ */
+template <byte_range Range, offset_range Offsets>
+auto base32hex_decode_batch(
+    Range const& a_data,
+    Offsets const& a_offsets,
+    std::error_code& a_ec,
+    std::pmr::memory_resource* a_resource = std::pmr::get_default_resource(),
+    bool a_strict = true,
+    char a_pad_character = '='
+)
+-> decoded_batch<std::ranges::range_value_t<Offsets>>
+{
+    return detail::decode_batch<base32hex_alphabet>(
+        detail::as_char_span(a_data),
+        detail::as_offset_span(a_offsets),
+        a_ec,
+        a_resource,
+        a_strict,
+        a_pad_character
+    );
+}
+
+/**
+ * @brief Encodes every value of a column as Base64.
+ *
+ * @param[in] a_data Data buffer of the column.
+ * @param[in] a_offsets The `n + 1` offsets of the `n` values into `a_data`.
+ * @param[in][out] a_ec std::error_code that gets set if the offsets aren't ascending and within
+ * `a_data`, or if the output doesn't fit the offset type.
+ * @param[in] a_resource Memory resource to allocate the output column from.
+ * @param[in] a_padding Should every value be padded with the given padding character.
+ * @param[in] a_pad_character Character to use as padding.
+ *
+ * @returns encoded_batch<Offset> The encoded column. Empty if an error occurred.
+ */
+template <byte_range Range, offset_range Offsets>
+auto base64_encode_batch(
+    Range const& a_data,
+    Offsets const& a_offsets,
+    std::error_code& a_ec,
+    std::pmr::memory_resource* a_resource = std::pmr::get_default_resource(),
+    bool a_padding = true,
+    char a_pad_character = '='
+)
+-> encoded_batch<std::ranges::range_value_t<Offsets>>
+{
+    return detail::encode_batch<base64_alphabet>(
+        detail::as_byte_span(a_data),
+        detail::as_offset_span(a_offsets),
+        a_ec,
+        a_resource,
+        a_padding,
+        a_pad_character
+    );
+}
+
+/**
+ * @brief Decodes every value of a Base64 encoded column.
+ *
+ * @param[in] a_data Data buffer of the column.
+ * @param[in] a_offsets The `n + 1` offsets of the `n` values into `a_data`.
+ * @param[in][out] a_ec std::error_code that gets set if the offsets aren't ascending and within
+ * `a_data`, or if any value can't be decoded.
+ * @param[in] a_resource Memory resource to allocate the output column from.
+ * @param[in] a_strict Enable/disable strict mode, see `base64_decode`.
+ * @param[in] a_pad_character Character to recognize as a padding character.
+ *
+ * @returns decoded_batch<Offset> The decoded column. Empty if an error occurred.
+ */
+template <byte_range Range, offset_range Offsets>
+auto base64_decode_batch(
+    Range const& a_data,
+    Offsets const& a_offsets,
+    std::error_code& a_ec,
+    std::pmr::memory_resource* a_resource = std::pmr::get_default_resource(),
+    bool a_strict = true,
+    char a_pad_character = '='
+)
+-> decoded_batch<std::ranges::range_value_t<Offsets>>
+{
+    return detail::decode_batch<base64_alphabet>(
+        detail::as_char_span(a_data),
+        detail::as_offset_span(a_offsets),
+        a_ec,
+        a_resource,
+        a_strict,
+        a_pad_character
+    );
+}
+
+/**
+ * @brief Encodes every value of a column as Base64Url.
+ *
+ * @param[in] a_data Data buffer of the column.
+ * @param[in] a_offsets The `n + 1` offsets of the `n` values into `a_data`.
+ * @param[in][out] a_ec std::error_code that gets set if the offsets aren't ascending and within
+ * `a_data`, or if the output doesn't fit the offset type.
+ * @param[in] a_resource Memory resource to allocate the output column from.
+ * @param[in] a_padding Should every value be padded with the given padding character.
+ * @param[in] a_pad_character Character to use as padding.
+ *
+ * @returns encoded_batch<Offset> The encoded column. Empty if an error occurred.
+ */
+template <byte_range Range, offset_range Offsets>
+auto base64url_encode_batch(
+    Range const& a_data,
+    Offsets const& a_offsets,
+    std::error_code& a_ec,
+    std::pmr::memory_resource* a_resource = std::pmr::get_default_resource(),
+    bool a_padding = false,
+    char a_pad_character = '='
+)
+-> encoded_batch<std::ranges::range_value_t<Offsets>>
+{
+    return detail::encode_batch<base64url_alphabet>(
+        detail::as_byte_span(a_data),
+        detail::as_offset_span(a_offsets),
+        a_ec,
+        a_resource,
+        a_padding,
+        a_pad_character
+    );
+}
+
+/**
+ * @brief Decodes every value of a Base64Url encoded column.
+ *
+ * @param[in] a_data Data buffer of the column.
+ * @param[in] a_offsets The `n + 1` offsets of the `n` values into `a_data`.
+ * @param[in][out] a_ec std::error_code that gets set if the offsets aren't ascending and within
+ * `a_data`, or if any value can't be decoded.
+ * @param[in] a_resource Memory resource to allocate the output column from.
+ * @param[in] a_strict Enable/disable strict mode, see `base64url_decode`.
+ * @param[in] a_pad_character Character to recognize as a padding character.
+ *
+ * @returns decoded_batch<Offset> The decoded column. Empty if an error occurred.
+ */
+template <byte_range Range, offset_range Offsets>
+auto base64url_decode_batch(
+    Range const& a_data,
+    Offsets const& a_offsets,
+    std::error_code& a_ec,
+    std::pmr::memory_resource* a_resource = std::pmr::get_default_resource(),
+    bool a_strict = true,
+    char a_pad_character = '='
+)
+-> decoded_batch<std::ranges::range_value_t<Offsets>>
+{
+    return detail::decode_batch<base64url_alphabet>(
+        detail::as_char_span(a_data),
+        detail::as_offset_span(a_offsets),
+        a_ec,
+        a_resource,
+        a_strict,
+        a_pad_character
+    );
+}
+
+/**
+ * @brief Encodes equal sized items, stored back to back, as Base16.
+ *
+ * @param[in] a_data The items, back to back.
+ * @param[in] a_item_size Size of every item in bytes.
+ * @param[in][out] a_ec std::error_code that gets set if `a_item_size` is 0 or doesn't divide the
+ * size of `a_data`.
+ * @param[in] a_resource Memory resource to allocate the output from.
+ *
+ * @returns std::pmr::string The encoded items, item `i` starting at character
+ * `i * base16_encoded_size(a_item_size)`. Empty if an error occurred.
+ */
+template <byte_range Range>
+auto base16_encode_items(
+    Range const& a_data,
+    std::size_t a_item_size,
+    std::error_code& a_ec,
+    std::pmr::memory_resource* a_resource = std::pmr::get_default_resource()
+)
+-> std::pmr::string
+{
+    return detail::encode_items<base16_alphabet>(
+        detail::as_byte_span(a_data),
+        a_item_size,
+        a_ec,
+        a_resource,
+        false,
+        '\0'
+    );
+}
+
+/**
+ * @brief Encodes equal sized items, stored back to back, as Base64.
+ *
+ * @param[in] a_data The items, back to back.
+ * @param[in] a_item_size Size of every item in bytes.
+ * @param[in][out] a_ec std::error_code that gets set if `a_item_size` is 0 or doesn't divide the
+ * size of `a_data`.
+ * @param[in] a_resource Memory resource to allocate the output from.
+ * @param[in] a_padding Should every item be padded with the given padding character.
+ * @param[in] a_pad_character Character to use as padding.
+ *
+ * @returns std::pmr::string The encoded items, item `i` starting at character
+ * `i * base64_encoded_size(a_item_size, a_padding)`. Empty if an error occurred.
+ */
+template <byte_range Range>
+auto base64_encode_items(
+    Range const& a_data,
+    std::size_t a_item_size,
+    std::error_code& a_ec,
+    std::pmr::memory_resource* a_resource = std::pmr::get_default_resource(),
+    bool a_padding = true,
+    char a_pad_character = '='
+)
+-> std::pmr::string
+{
+    return detail::encode_items<base64_alphabet>(
+        detail::as_byte_span(a_data),
+        a_item_size,
+        a_ec,
+        a_resource,
+        a_padding,
+        a_pad_character
+    );
+}
+
+/**
+ * @brief Encodes equal sized items, stored back to back, as Base64Url.
+ *
+ * @param[in] a_data The items, back to back.
+ * @param[in] a_item_size Size of every item in bytes.
+ * @param[in][out] a_ec std::error_code that gets set if `a_item_size` is 0 or doesn't divide the
+ * size of `a_data`.
+ * @param[in] a_resource Memory resource to allocate the output from.
+ * @param[in] a_padding Should every item be padded with the given padding character.
+ * @param[in] a_pad_character Character to use as padding.
+ *
+ * @returns std::pmr::string The encoded items, item `i` starting at character
+ * `i * base64_encoded_size(a_item_size, a_padding)`. Empty if an error occurred.
+ */
+template <byte_range Range>
+auto base64url_encode_items(
+    Range const& a_data,
+    std::size_t a_item_size,
+    std::error_code& a_ec,
+    std::pmr::memory_resource* a_resource = std::pmr::get_default_resource(),
+    bool a_padding = false,
+    char a_pad_character = '='
+)
+-> std::pmr::string
+{
+    return detail::encode_items<base64url_alphabet>(
+        detail::as_byte_span(a_data),
+        a_item_size,
+        a_ec,
+        a_resource,
+        a_padding,
+        a_pad_character
+    );
+}
+
+}   // namespace base_codec
+}   // namespace rs
@@ -0,0 +1,81 @@
+/**
+ * @file byte_range.hpp
+ *
+ * Concepts and helpers that let the codecs work directly on the caller's own containers.
+ */
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+
+namespace rs
+{
+namespace base_codec
+{
+
+/**
+ * @brief Any contiguous, sized range of byte sized elements - `std::string`, `std::span<std::byte
+ * const>`, `std::array<std::uint8_t, N>`, `std::vector<char>` and so on.
+ */
+template <typename Range>
+concept byte_range = std::ranges::contiguous_range<Range> &&
+                     std::ranges::sized_range<Range> &&
+                     sizeof(std::ranges::range_value_t<Range>) == 1 &&
+                     (std::is_integral_v<std::ranges::range_value_t<Range>> ||
+                      std::is_same_v<std::ranges::range_value_t<Range>, std::byte>);
+
+/**
+ * @brief A resizable byte container the decoders can return directly, e.g. `std::string`.
+ */
+template <typename Container>
+concept byte_container = byte_range<Container> &&
+                         std::default_initializable<Container> &&
+                         requires(Container& a_container, std::size_t a_size)
+                         {
+                             a_container.resize(a_size);
+                         };
+
+namespace detail
+{
+
+/**
+ * Views a byte range as the `std::uint8_t` span the codecs work with.
+ */
+template <byte_range Range>
+auto as_byte_span(Range const& a_range) -> std::span<std::uint8_t const>
+{
+    return {
+        reinterpret_cast<std::uint8_t const*>(std::ranges::data(a_range)),
+        std::ranges::size(a_range)
+    };
+}
+
+/**
+ * Views a mutable byte range as a writable `std::uint8_t` span.
+ */
+template <byte_range Range>
+auto as_writable_byte_span(Range& a_range) -> std::span<std::uint8_t>
+{
+    return {
+        reinterpret_cast<std::uint8_t*>(std::ranges::data(a_range)),
+        std::ranges::size(a_range)
+    };
+}
+
+/**
+ * Views a mutable byte range as a writable `char` span.
+ */
+template <byte_range Range>
+auto as_writable_char_span(Range& a_range) -> std::span<char>
+{
+    return {reinterpret_cast<char*>(std::ranges::data(a_range)), std::ranges::size(a_range)};
+}
+
+}   // namespace detail
+}   // namespace base_codec
+}   // namespace rs
@@ -0,0 +1,187 @@
+/**
+ * @file constant.hpp
+ *
+ * Compile time encoding and decoding of constants, behind the `consteval` functions and the
+ * user-defined literals of the codecs. Malformed input doesn't compile.
+ */
+#pragma once
+
+#include <base_codec/alphabet.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+
+namespace rs
+{
+namespace base_codec
+{
+
+/**
+ * @brief String literal wrapper that can be passed as a template argument, e.g. to
+ * `base64_decode_constant<"Zm9vYmFy">()`.
+ */
+template <std::size_t Size>
+struct fixed_string
+{
+    consteval fixed_string(char const (&a_data)[Size])
+    {
+        for (std::size_t i = 0; i < Size; ++i)
+        {
+            data[i] = a_data[i];
+        }
+    }
+
+    consteval auto view() const -> std::string_view
+    {
+        return {data.data(), Size - 1};
+    }
+
+    std::array<char, Size> data {};
+};
+
+namespace detail
+{
+
+/**
+ * Not `constexpr` on purpose - reaching it during constant evaluation is what turns malformed
+ * input into a compile error, which names this function.
+ */
+inline auto malformed_encoded_constant() -> void
+{
+}
+
+/**
+ * Number of characters encoding `a_size` bytes with the given alphabet.
+ */
+template <typename Alphabet, bool Padding>
+consteval auto constant_encoded_size(std::size_t a_size) -> std::size_t
+{
+    auto const symbols = (a_size * 8 + Alphabet::bits - 1) / Alphabet::bits;
+
+    if constexpr (Padding && Alphabet::has_padding)
+    {
+        return (symbols + Alphabet::block_symbols - 1) / Alphabet::block_symbols *
+               Alphabet::block_symbols;
+    } else
+    {
+        return symbols;
+    }
+}
+
+template <typename Alphabet, bool Padding, std::size_t Size>
+consteval auto encode_constant(std::array<std::uint8_t, Size> const& a_data)
+-> std::array<char, constant_encoded_size<Alphabet, Padding>(Size)>
+{
+    constexpr std::uint32_t symbol_mask = (1u << Alphabet::bits) - 1;
+
+    std::array<char, constant_encoded_size<Alphabet, Padding>(Size)> ret {};
+    std::uint32_t bit_buffer = 0;
+    std::size_t num_bits = 0;
+    std::size_t out = 0;
+
+    for (auto const datum : a_data)
+    {
+        bit_buffer = (bit_buffer << 8) | datum;
+        num_bits += 8;
+
+        while (num_bits >= Alphabet::bits)
+        {
+            num_bits -= Alphabet::bits;
+            ret[out++] = Alphabet::symbols[(bit_buffer >> num_bits) & symbol_mask];
+        }
+    }
+
+    if (num_bits > 0)
+    {
+        ret[out++] = Alphabet::symbols[(bit_buffer << (Alphabet::bits - num_bits)) & symbol_mask];
+    }
+
+    while (out < ret.size())
+    {
+        ret[out++] = '=';
+    }
+
+    return ret;
+}
+
+/**
+ * Number of characters of an encoded constant left after dropping its padding.
+ */
+template <typename Alphabet>
+consteval auto constant_symbols(std::string_view a_data) -> std::size_t
+{
+    auto size = a_data.size();
+
+    if constexpr (Alphabet::has_padding)
+    {
+        while (size > 0 && a_data[size - 1] == '=')
+        {
+            --size;
+        }
+    }
+
+    return size;
+}
+
+template <typename Alphabet, fixed_string Encoded>
+consteval auto decode_constant()
+-> std::array<std::uint8_t, constant_symbols<Alphabet>(Encoded.view()) * Alphabet::bits / 8>
+{
+    constexpr auto data = Encoded.view();
+    constexpr auto symbols = constant_symbols<Alphabet>(data);
+    constexpr auto decode_values = decode_table<Alphabet>;
+
+    std::array<std::uint8_t, symbols * Alphabet::bits / 8> ret {};
+
+    // NOTE - Padding is optional, but when present it has to complete the last block - no more,
+    //        no less. A partial block is only valid if it's the shortest encoding of its bytes.
+    constexpr auto partial = symbols % Alphabet::block_symbols;
+    constexpr auto partial_bytes = partial * Alphabet::bits / 8;
+    constexpr auto padded_size = (symbols + Alphabet::block_symbols - 1) /
+                                 Alphabet::block_symbols * Alphabet::block_symbols;
+
+    if ((data.size() != symbols && data.size() != padded_size) ||
+        partial != (partial_bytes * 8 + Alphabet::bits - 1) / Alphabet::bits)
+    {
+        malformed_encoded_constant();
+    }
+
+    std::uint32_t bit_buffer = 0;
+    std::size_t num_bits = 0;
+    std::size_t out = 0;
+
+    for (std::size_t i = 0; i < symbols; ++i)
+    {
+        auto const value = decode_values[static_cast<unsigned char>(data[i])];
+
+        if (value == invalid_symbol)
+        {
+            malformed_encoded_constant();
+        }
+
+        bit_buffer = (bit_buffer << Alphabet::bits) | value;
+        num_bits += Alphabet::bits;
+
+        if (num_bits >= 8)
+        {
+            num_bits -= 8;
+            ret[out++] = static_cast<std::uint8_t>(bit_buffer >> num_bits);
+        }
+    }
+
+    // NOTE - The bits of the last symbol past the last byte have to be zero, else several
+    //        encodings would decode to the same bytes.
+    if ((bit_buffer & ((std::uint32_t {1} << num_bits) - 1)) != 0)
+    {
+        malformed_encoded_constant();
+    }
+
+    return ret;
+}
+
+}   // namespace detail
+}   // namespace base_codec
+}   // namespace rs
@@ -0,0 +1,75 @@
+/**
+ * @file dispatch.hpp
+ *
+ * Runtime selection of the instruction set used by the encoding/decoding kernels.
+ *
+ * The CPU is probed once, on first use, and every public routine gets bound to the fastest kernel
+ * tier the machine supports. The choice can be overridden with the `BASE_CODEC_KERNEL`
+ * environment variable (`scalar`, `sse41`, `avx2` or `avx512`) - a tier the CPU doesn't support
+ * is clamped down to the best one that it does. When the library is built with
+ * `-DBASE_CODEC_NATIVE=ON` the tier is fixed at compile time and no probing takes place.
+ */
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <system_error>
+
+
+namespace rs
+{
+namespace base_codec
+{
+
+/**
+ * @brief Instruction set tiers the kernels are built for, ordered from slowest to fastest.
+ *
+ * The `avx512` tier requires AVX-512 F, BW and VBMI (Ice Lake and newer).
+ */
+enum class kernel_tier : std::uint8_t
+{
+    scalar = 0,
+    sse41,
+    avx2,
+    avx512
+};
+
+/**
+ * @brief Returns the printable name of a kernel tier, as accepted by `BASE_CODEC_KERNEL`.
+ */
+auto kernel_tier_name(kernel_tier a_tier) -> std::string_view;
+
+/**
+ * @brief Checks if the current CPU (and library build) can run the given kernel tier. A native
+ * build only supports the tier it was compiled for.
+ */
+auto is_kernel_tier_supported(kernel_tier a_tier) -> bool;
+
+/**
+ * @brief Returns the fastest kernel tier supported by the current CPU and library build.
+ */
+auto best_kernel_tier() -> kernel_tier;
+
+/**
+ * @brief Returns the kernel tier the public routines are currently bound to.
+ */
+auto active_kernel_tier() -> kernel_tier;
+
+/**
+ * @brief Rebinds the public routines to the given kernel tier.
+ *
+ * Meant for testing and benchmarking - it isn't synchronized with calls that are already running
+ * on other threads, although those will simply finish on the previous tier.
+ *
+ * @param[in] a_tier Tier to switch to.
+ * @param[in][out] a_ec std::error_code that gets set if the tier isn't supported, or if the
+ * library was built with a fixed native tier.
+ */
+auto set_kernel_tier(
+    kernel_tier a_tier,
+    std::error_code& a_ec
+)
+-> void;
+
+}   // namespace base_codec
+}   // namespace rs
@@ -0,0 +1,150 @@
+/**
+ * @file fixed.hpp
+ *
+ * Encoding and decoding of inputs whose size is known at compile time - digests, UUIDs, keys. The
+ * bit offset of every symbol is a constant, so the whole transform gets expanded into straight
+ * line code, without loops, tail handling or allocations.
+ */
+#pragma once
+
+#include <base_codec/alphabet.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+
+namespace rs
+{
+namespace base_codec
+{
+namespace detail
+{
+
+/**
+ * Number of characters encoding `Size` bytes, without padding.
+ */
+template <typename Alphabet, std::size_t Size>
+inline constexpr std::size_t fixed_symbols = (Size * 8 + Alphabet::bits - 1) / Alphabet::bits;
+
+/**
+ * Number of characters encoding `Size` bytes.
+ */
+template <typename Alphabet, bool Padding, std::size_t Size>
+inline constexpr std::size_t fixed_encoded_size = Padding && Alphabet::has_padding
+    ? (fixed_symbols<Alphabet, Size> + Alphabet::block_symbols - 1) / Alphabet::block_symbols *
+      Alphabet::block_symbols
+    : fixed_symbols<Alphabet, Size>;
+
+/**
+ * Value of the symbol at `Index`, taken from the (at most two) bytes it overlaps.
+ */
+template <typename Alphabet, std::size_t Index, std::size_t Size>
+constexpr auto fixed_symbol_value(std::array<std::uint8_t, Size> const& a_data) -> std::uint32_t
+{
+    constexpr auto first_bit = Index * Alphabet::bits;
+    constexpr auto byte = first_bit / 8;
+    constexpr auto shift = 16 - Alphabet::bits - first_bit % 8;
+
+    std::uint32_t window = static_cast<std::uint32_t>(a_data[byte]) << 8;
+
+    if constexpr (byte + 1 < Size)
+    {
+        window |= a_data[byte + 1];
+    }
+
+    return (window >> shift) & ((1u << Alphabet::bits) - 1);
+}
+
+template <typename Alphabet, bool Padding, std::size_t Size>
+constexpr auto encode_fixed(std::array<std::uint8_t, Size> const& a_data)
+-> std::array<char, fixed_encoded_size<Alphabet, Padding, Size>>
+{
+    constexpr auto symbols = fixed_symbols<Alphabet, Size>;
+
+    std::array<char, fixed_encoded_size<Alphabet, Padding, Size>> ret;
+
+    [&]<std::size_t... Index>(std::index_sequence<Index...>)
+    {
+        ((ret[Index] = Index < symbols
+            ? Alphabet::symbols[fixed_symbol_value<Alphabet, Index>(a_data)]
+            : '='), ...);
+    }(std::make_index_sequence<ret.size()>());
+
+    return ret;
+}
+
+/**
+ * Byte at `Index`, assembled from the (at most three) symbol values it overlaps.
+ */
+template <typename Alphabet, std::size_t Index, std::size_t Symbols>
+constexpr auto fixed_byte_value(std::array<std::uint8_t, Symbols> const& a_values) -> std::uint8_t
+{
+    constexpr auto first = Index * 8 / Alphabet::bits;
+    constexpr auto last = (Index * 8 + 7) / Alphabet::bits;
+    constexpr auto shift = (last + 1) * Alphabet::bits - (Index + 1) * 8;
+
+    std::uint32_t window = 0;
+
+    [&]<std::size_t... Offset>(std::index_sequence<Offset...>)
+    {
+        ((window = (window << Alphabet::bits) | a_values[first + Offset]), ...);
+    }(std::make_index_sequence<last - first + 1>());
+
+    return static_cast<std::uint8_t>(window >> shift);
+}
+
+template <typename Alphabet, bool Padding, std::size_t Size>
+constexpr auto decode_fixed(
+    std::string_view const& a_data,
+    std::error_code& a_ec
+)
+-> std::array<std::uint8_t, Size>
+{
+    constexpr auto symbols = fixed_symbols<Alphabet, Size>;
+    constexpr auto encoded_size = fixed_encoded_size<Alphabet, Padding, Size>;
+
+    if (a_data.size() != encoded_size)
+    {
+        a_ec = std::make_error_code(std::errc::invalid_argument);
+        return {};
+    }
+
+    std::array<std::uint8_t, symbols> values;
+    std::uint32_t errors = 0;
+
+    // NOTE - Invalid characters map to 0xFF, so a single test of the OR of every value (and of
+    //        the padding characters) catches all of them.
+    [&]<std::size_t... Index>(std::index_sequence<Index...>)
+    {
+        ((values[Index] = decode_table<Alphabet>[static_cast<unsigned char>(a_data[Index])],
+          errors |= values[Index]), ...);
+    }(std::make_index_sequence<symbols>());
+
+    [&]<std::size_t... Index>(std::index_sequence<Index...>)
+    {
+        ((errors |= a_data[symbols + Index] == '=' ? 0u : 0x80u), ...);
+    }(std::make_index_sequence<encoded_size - symbols>());
+
+    if (errors & 0xC0)
+    {
+        a_ec = std::make_error_code(std::errc::invalid_argument);
+        return {};
+    }
+
+    std::array<std::uint8_t, Size> ret;
+
+    [&]<std::size_t... Index>(std::index_sequence<Index...>)
+    {
+        ((ret[Index] = fixed_byte_value<Alphabet, Index>(values)), ...);
+    }(std::make_index_sequence<Size>());
+
+    return ret;
+}
+
+}   // namespace detail
+}   // namespace base_codec
+}   // namespace rs
@@ -0,0 +1,82 @@
+/**
+ * @file memory_resource.hpp
+ *
+ * Memory resource tuned for large encode/decode outputs, to be used with the `std::pmr`
+ * overloads of the codecs.
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+
+
+namespace rs
+{
+namespace base_codec
+{
+
+/**
+ * @brief Memory resource that hands out 64-byte aligned blocks, and serves the large ones from
+ * their own anonymous mappings backed by transparent huge pages.
+ *
+ * Small allocations (below the threshold) are forwarded to the upstream resource, only with
+ * their alignment raised to a cache line. Allocations at or above the threshold get mapped
+ * directly, aligned and rounded to 2 MiB and advised with `MADV_HUGEPAGE`, which cuts down the
+ * TLB misses when walking 100 MB+ buffers. On platforms without `mmap` everything goes upstream.
+ *
+ * The resource itself is thread safe as long as its upstream resource is.
+ */
+class huge_page_resource : public std::pmr::memory_resource
+{
+public:
+    /**
+     * Allocations of at least this many bytes get their own huge page mapping by default.
+     */
+    static constexpr std::size_t default_threshold = std::size_t {2} << 20;
+
+    /**
+     * Alignment of every block handed out.
+     */
+    static constexpr std::size_t alignment = 64;
+
+    /**
+     * @param[in] a_threshold Allocations of at least this many bytes get their own mapping.
+     * @param[in] a_upstream Resource serving the allocations below the threshold.
+     */
+    explicit huge_page_resource(
+        std::size_t a_threshold = default_threshold,
+        std::pmr::memory_resource* a_upstream = std::pmr::get_default_resource()
+    );
+
+    auto threshold() const -> std::size_t;
+
+    auto upstream_resource() const -> std::pmr::memory_resource*;
+
+private:
+    auto do_allocate(
+        std::size_t a_bytes,
+        std::size_t a_alignment
+    )
+    -> void* override;
+
+    auto do_deallocate(
+        void* a_pointer,
+        std::size_t a_bytes,
+        std::size_t a_alignment
+    )
+    -> void override;
+
+    auto do_is_equal(std::pmr::memory_resource const& a_other) const noexcept -> bool override;
+
+    std::size_t m_threshold;
+    std::pmr::memory_resource* m_upstream;
+};
+
+/**
+ * @brief Returns a process wide `huge_page_resource` with the default threshold, on top of the
+ * default resource.
+ */
+auto huge_page_resource_instance() -> huge_page_resource*;
+
+}   // namespace base_codec
+}   // namespace rs
@@ -0,0 +1,924 @@
+/**
+ * @file parallel.hpp
+ *
+ * Multi-threaded encoding and decoding of large buffers. Inputs to encode get split on block
+ * boundaries, so the output offset of every chunk is known up front and the chunks get encoded
+ * concurrently into a single preallocated output. Inputs to decode get a pre-pass counting the
+ * symbols of every chunk first, as skipped characters can shift the blocks around. Inputs below a
+ * size threshold are handled on the calling thread.
+ *
+ * The work runs on an `executor` - the process wide `thread_pool` unless another one is given.
+ */
+#pragma once
+
+#include <base_codec/alphabet.hpp>
+#include <base_codec/base16.hpp>
+#include <base_codec/base32.hpp>
+#include <base_codec/base64.hpp>
+#include <base_codec/byte_range.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+
+namespace rs
+{
+namespace base_codec
+{
+
+/**
+ * @brief Interface of the executors running the chunks of the parallel codecs, in the spirit of
+ * `std::pmr::memory_resource`: derive from it to run them on an existing thread pool.
+ */
+class executor
+{
+public:
+    virtual ~executor() = default;
+
+    /**
+     * @brief Calls `a_task` once for every index in `[0, a_count)`, possibly concurrently, and
+     * returns once all of the calls have returned. The tasks don't throw.
+     */
+    auto bulk_execute(
+        std::size_t a_count,
+        std::function<void(std::size_t)> const& a_task
+    )
+    -> void
+    {
+        do_bulk_execute(a_count, a_task);
+    }
+
+    /**
+     * @brief Returns the number of tasks the executor can run at the same time.
+     */
+    auto concurrency() const -> std::size_t
+    {
+        return do_concurrency();
+    }
+
+private:
+    virtual auto do_bulk_execute(
+        std::size_t a_count,
+        std::function<void(std::size_t)> const& a_task
+    )
+    -> void = 0;
+
+    virtual auto do_concurrency() const -> std::size_t = 0;
+};
+
+/**
+ * @brief Work stealing thread pool. Every `bulk_execute` splits its indices into one slice per
+ * thread, the calling thread included, and a thread which runs out of its own slice steals from
+ * the slices of the others, so uneven chunks don't leave threads idle.
+ *
+ * Calls to `bulk_execute` from different threads are run one after the other. Calling it from
+ * within one of its own tasks deadlocks.
+ */
+class thread_pool final : public executor
+{
+public:
+    /**
+     * @param[in] a_concurrency Number of threads to run tasks on, the calling thread included. 0
+     * picks `std::thread::hardware_concurrency()`.
+     */
+    explicit thread_pool(std::size_t a_concurrency = 0);
+
+    thread_pool(thread_pool const&) = delete;
+    auto operator=(thread_pool const&) -> thread_pool& = delete;
+
+    ~thread_pool() override;
+
+private:
+    struct state;
+
+    auto do_bulk_execute(
+        std::size_t a_count,
+        std::function<void(std::size_t)> const& a_task
+    )
+    -> void override;
+
+    auto do_concurrency() const -> std::size_t override;
+
+    std::unique_ptr<state> m_state;
+};
+
+/**
+ * @brief Returns a process wide `thread_pool` using every hardware thread, started on first use.
+ */
+auto thread_pool_instance() -> thread_pool*;
+
+/**
+ * @brief Inputs below this many bytes (or characters) are handled on the calling thread by default.
+ */
+inline constexpr std::size_t default_parallel_threshold = std::size_t {1} << 20;
+
+/**
+ * @brief Options of the parallel overloads of the codecs.
+ */
+struct parallel_options
+{
+    /**
+     * Executor to run the chunks on, `thread_pool_instance()` if null.
+     */
+    executor* target = nullptr;
+
+    /**
+     * Inputs smaller than this many bytes (or characters) are handled on the calling thread.
+     */
+    std::size_t threshold = default_parallel_threshold;
+};
+
+/**
+ * @brief Default parallel options, e.g. `base64_encode(data, ec, rs::base_codec::parallel)`.
+ */
+inline constexpr parallel_options parallel {};
+
+namespace detail
+{
+
+// NOTE - Defined in src/parallel.cpp for every alphabet.
+template <typename Alphabet>
+auto encode_parallel(
+    std::span<std::uint8_t const> a_data,
+    char* a_out,
+    bool a_padding,
+    char a_pad_character,
+    parallel_options const& a_options
+)
+-> void;
+
+// NOTE - Defined in src/parallel.cpp for every alphabet. `a_out` has room for the decoded size.
+template <typename Alphabet>
+auto decode_parallel(
+    std::string_view const& a_data,
+    std::uint8_t* a_out,
+    std::error_code& a_ec,
+    bool a_strict,
+    char a_pad_character,
+    parallel_options const& a_options
+)
+-> std::size_t;
+
+}   // namespace detail
+
+/**
+ * @brief Encodes any contiguous range of bytes as a Base16 string, on several threads if it is
+ * large enough.
+ *
+ * @param[in] a_data Bytes to encode.
+ * @param[in][out] a_ec std::error_code, kept for symmetry with the serial overload - encoding a
+ * range can't fail.
+ * @param[in] a_options Executor and size threshold to use.
+ *
+ * @returns std::string The encoded string.
+ */
+template <byte_range Range>
+auto base16_encode(
+    Range const& a_data,
+    std::error_code& /* a_ec */,
+    parallel_options const& a_options
+)
+-> std::string
+{
+    std::string ret(base16_encoded_size(std::ranges::size(a_data)), '\0');
+    detail::encode_parallel<base16_alphabet>(
+        detail::as_byte_span(a_data),
+        ret.data(),
+        false,
+        '\0',
+        a_options
+    );
+    return ret;
+}
+
+/**
+ * @brief Encodes any contiguous range of bytes as a Base32 string, on several threads if it is
+ * large enough.
+ *
+ * @param[in] a_data Bytes to encode.
+ * @param[in][out] a_ec std::error_code, kept for symmetry with the serial overload - encoding a
+ * range can't fail.
+ * @param[in] a_options Executor and size threshold to use.
+ * @param[in] a_padding Should the string be padded at the end with the given padding character, if
+ * it's too short.
+ * @param[in] a_pad_character Character to use as padding.
+ *
+ * @returns std::string The encoded string.
+ */
+template <byte_range Range>
+auto base32_encode(
+    Range const& a_data,
+    std::error_code& /* a_ec */,
+    parallel_options const& a_options,
+    bool a_padding = true,
+    char a_pad_character = '='
+)
+-> std::string
+{
+    std::string ret(base32_encoded_size(std::ranges::size(a_data), a_padding), '\0');
+    detail::encode_parallel<base32_alphabet>(
+        detail::as_byte_span(a_data),
+        ret.data(),
+        a_padding,
+        a_pad_character,
+        a_options
+    );
+    return ret;
+}
+
+/**
+ * @brief Encodes any contiguous range of bytes as a Base32Hex string, on several threads if it
+ * is large enough.
+ *
+ * @param[in] a_data Bytes to encode.
+ * @param[in][out] a_ec std::error_code, kept for symmetry with the serial overload - encoding a
+ * range can't fail.
+ * @param[in] a_options Executor and size threshold to use.
+ * @param[in] a_padding Should the string be padded at the end with the given padding character, if
+ * it's too short.
+ * @param[in] a_pad_character Character to use as padding.
+ *
+ * @returns std::string The encoded string.
+ */
+template <byte_range Range>
+auto base32hex_encode(
+    Range const& a_data,
+    std::error_code& /* a_ec */,
+    parallel_options const& a_options,
+    bool a_padding = true,
+    char a_pad_character = '='
+)
+-> std::string
+{
+    std::string ret(base32_encoded_size(std::ranges::size(a_data), a_padding), '\0');
+    detail::encode_parallel<base32hex_alphabet>(
+        detail::as_byte_span(a_data),
+        ret.data(),
+        a_padding,
+        a_pad_character,
+        a_options
+    );
+    return ret;
+}
+
+/**
+ * @brief Encodes any contiguous range of bytes as a Base64 string, on several threads if it is
+ * large enough.
+ *
+ * @param[in] a_data Bytes to encode.
+ * @param[in][out] a_ec std::error_code, kept for symmetry with the serial overload - encoding a
+ * range can't fail.
+ * @param[in] a_options Executor and size threshold to use.
+ * @param[in] a_padding Should the string be padded at the end with the given padding character, if
+ * it's too short.
+ * @param[in] a_pad_character Character to use as padding.
+ *
+ * @returns std::string The encoded string.
+ */
+template <byte_range Range>
+auto base64_encode(
+    Range const& a_data,
+    std::error_code& /* a_ec */,
+    parallel_options const& a_options,
+    bool a_padding = true,
+    char a_pad_character = '='
+)
+-> std::string
+{
+    std::string ret(base64_encoded_size(std::ranges::size(a_data), a_padding), '\0');
+    detail::encode_parallel<base64_alphabet>(
+        detail::as_byte_span(a_data),
+        ret.data(),
+        a_padding,
+        a_pad_character,
+        a_options
+    );
+    return ret;
+}
+
+/**
+ * @brief Encodes any contiguous range of bytes as a Base64Url string, on several threads if it
+ * is large enough.
+ *
+ * @param[in] a_data Bytes to encode.
+ * @param[in][out] a_ec std::error_code, kept for symmetry with the serial overload - encoding a
+ * range can't fail.
+ * @param[in] a_options Executor and size threshold to use.
+ * @param[in] a_padding Should the string be padded at the end with the given padding character, if
+ * it's too short.
+ * @param[in] a_pad_character Character to use as padding.
+ *
+ * @returns std::string The encoded string.
+ */
+template <byte_range Range>
+auto base64url_encode(
+    Range const& a_data,
+    std::error_code& /* a_ec */,
+    parallel_options const& a_options,
+    bool a_padding = false,
+    char a_pad_character = '='
+)
+-> std::string
+{
+    std::string ret(base64_encoded_size(std::ranges::size(a_data), a_padding), '\0');
+    detail::encode_parallel<base64url_alphabet>(
+        detail::as_byte_span(a_data),
+        ret.data(),
+        a_padding,
+        a_pad_character,
+        a_options
+    );
+    return ret;
+}
+
+/**
+ * @brief Decodes a Base16 encoded string, on several threads if it is large enough. Strict mode
+ * fails on the earliest invalid character of the whole string, like `base16_decode` does.
+ *
+ * @param[in] a_data Base16 encoded string to decode.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs.
+ * @param[in] a_options Executor and size threshold to use.
+ * @param[in] a_strict Enable/disable strict mode, see `base16_decode`.
+ *
+ * @returns std::vector<std::uint8_t> Byte representation of the decoded string.
+ */
+inline auto base16_decode(
+    std::string_view const& a_data,
+    std::error_code& a_ec,
+    parallel_options const& a_options,
+    bool a_strict = true
+)
+-> std::vector<std::uint8_t>
+{
+    std::vector<std::uint8_t> ret(base16_decoded_size(a_data));
+    ret.resize(detail::decode_parallel<base16_alphabet>(
+        a_data,
+        ret.data(),
+        a_ec,
+        a_strict,
+        '\0',
+        a_options
+    ));
+    return ret;
+}
+
+/**
+ * @brief Decodes a Base32 encoded string, on several threads if it is large enough. Strict mode
+ * fails on the earliest invalid character of the whole string, like `base32_decode` does.
+ *
+ * @param[in] a_data Base32 encoded string to decode.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs.
+ * @param[in] a_options Executor and size threshold to use.
+ * @param[in] a_strict Enable/disable strict mode, see `base32_decode`.
+ * @param[in] a_pad_character Character to recognize as a padding character.
+ *
+ * @returns std::vector<std::uint8_t> Byte representation of the decoded string.
+ */
+inline auto base32_decode(
+    std::string_view const& a_data,
+    std::error_code& a_ec,
+    parallel_options const& a_options,
+    bool a_strict = true,
+    char a_pad_character = '='
+)
+-> std::vector<std::uint8_t>
+{
+    std::vector<std::uint8_t> ret(base32_decoded_size(a_data, a_pad_character));
+    ret.resize(detail::decode_parallel<base32_alphabet>(
+        a_data,
+        ret.data(),
+        a_ec,
+        a_strict,
+        a_pad_character,
+        a_options
+    ));
+    return ret;
+}
+
+/**
+ * @brief Decodes a Base32Hex encoded string, on several threads if it is large enough. Strict mode
+ * fails on the earliest invalid character of the whole string, like `base32hex_decode` does.
+ *
+ * @param[in] a_data Base32Hex encoded string to decode.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs.
+ * @param[in] a_options Executor and size threshold to use.
+ * @param[in] a_strict Enable/disable strict mode, see `base32hex_decode`.
+ * @param[in] a_pad_character Character to recognize as a padding character.
+ *
+ * @returns std::vector<std::uint8_t> Byte representation of the decoded string.
+ */
+inline auto base32hex_decode(
+    std::string_view const& a_data,
+    std::error_code& a_ec,
+    parallel_options const& a_options,
+    bool a_strict = true,
+    char a_pad_character = '='
+)
+-> std::vector<std::uint8_t>
+{
+    std::vector<std::uint8_t> ret(base32_decoded_size(a_data, a_pad_character));
+    ret.resize(detail::decode_parallel<base32hex_alphabet>(
+        a_data,
+        ret.data(),
+        a_ec,
+        a_strict,
+        a_pad_character,
+        a_options
+    ));
+    return ret;
+}
+
+/**
+ * @brief Decodes a Base64 encoded string, on several threads if it is large enough. Strict mode
+ * fails on the earliest invalid character of the whole string, like `base64_decode` does.
+ *
+ * @param[in] a_data Base64 encoded string to decode.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs.
+ * @param[in] a_options Executor and size threshold to use.
+ * @param[in] a_strict Enable/disable strict mode, see `base64_decode`.
+ * @param[in] a_pad_character Character to recognize as a padding character.
+ *
+ * @returns std::vector<std::uint8_t> Byte representation of the decoded string.
+ */
+inline auto base64_decode(
+    std::string_view const& a_data,
+    std::error_code& a_ec,
+    parallel_options const& a_options,
+    bool a_strict = true,
+    char a_pad_character = '='
+)
+-> std::vector<std::uint8_t>
+{
+    std::vector<std::uint8_t> ret(base64_decoded_size(a_data, a_pad_character));
+    ret.resize(detail::decode_parallel<base64_alphabet>(
+        a_data,
+        ret.data(),
+        a_ec,
+        a_strict,
+        a_pad_character,
+        a_options
+    ));
+    return ret;
+}
+
+/**
+ * @brief Decodes a Base64Url encoded string, on several threads if it is large enough. Strict mode
+ * fails on the earliest invalid character of the whole string, like `base64url_decode` does.
+ *
+ * @param[in] a_data Base64Url encoded string to decode.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs.
+ * @param[in] a_options Executor and size threshold to use.
+ * @param[in] a_strict Enable/disable strict mode, see `base64url_decode`.
+ * @param[in] a_pad_character Character to recognize as a padding character.
+ *
+ * @returns std::vector<std::uint8_t> Byte representation of the decoded string.
+ */
+inline auto base64url_decode(
+    std::string_view const& a_data,
+    std::error_code& a_ec,
+    parallel_options const& a_options,
+    bool a_strict = true,
+    char a_pad_character = '='
+)
+-> std::vector<std::uint8_t>
+{
+    std::vector<std::uint8_t> ret(base64_decoded_size(a_data, a_pad_character));
+    ret.resize(detail::decode_parallel<base64url_alphabet>(
+        a_data,
+        ret.data(),
+        a_ec,
+        a_strict,
+        a_pad_character,
+        a_options
+    ));
+    return ret;
+}
+
+/**
+ * @brief Encodes bytes as a Base16 string into a caller provided buffer, e.g. a memory mapped
+ * file, on several threads if they are large enough.
+ *
+ * @param[in] a_data Bytes to encode.
+ * @param[out] a_out Buffer to write the encoded string into. Has to hold at least
+ * `base16_encoded_size(a_data.size())` characters.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs, e.g. if the buffer is
+ * too small.
+ * @param[in] a_options Executor and size threshold to use.
+ *
+ * @returns std::size_t Number of characters written. 0 if an error occurred.
+ */
+inline auto base16_encode_into(
+    std::span<std::uint8_t const> a_data,
+    std::span<char> a_out,
+    std::error_code& a_ec,
+    parallel_options const& a_options
+)
+-> std::size_t
+{
+    auto const size = base16_encoded_size(a_data.size());
+
+    if (a_out.size() < size)
+    {
+        a_ec = std::make_error_code(std::errc::no_buffer_space);
+        return 0;
+    }
+
+    detail::encode_parallel<base16_alphabet>(
+        a_data,
+        a_out.data(),
+        false,
+        '\0',
+        a_options
+    );
+    return size;
+}
+
+/**
+ * @brief Encodes bytes as a Base32 string into a caller provided buffer, e.g. a memory mapped
+ * file, on several threads if they are large enough.
+ *
+ * @param[in] a_data Bytes to encode.
+ * @param[out] a_out Buffer to write the encoded string into. Has to hold at least
+ * `base32_encoded_size(a_data.size(), a_padding)` characters.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs, e.g. if the buffer is
+ * too small.
+ * @param[in] a_options Executor and size threshold to use.
+ * @param[in] a_padding Should the string be padded at the end with the given padding character, if
+ * it's too short.
+ * @param[in] a_pad_character Character to use as padding.
+ *
+ * @returns std::size_t Number of characters written. 0 if an error occurred.
+ */
+inline auto base32_encode_into(
+    std::span<std::uint8_t const> a_data,
+    std::span<char> a_out,
+    std::error_code& a_ec,
+    parallel_options const& a_options,
+    bool a_padding = true,
+    char a_pad_character = '='
+)
+-> std::size_t
+{
+    auto const size = base32_encoded_size(a_data.size(), a_padding);
+
+    if (a_out.size() < size)
+    {
+        a_ec = std::make_error_code(std::errc::no_buffer_space);
+        return 0;
+    }
+
+    detail::encode_parallel<base32_alphabet>(
+        a_data,
+        a_out.data(),
+        a_padding,
+        a_pad_character,
+        a_options
+    );
+    return size;
+}
+
+/**
+ * @brief Encodes bytes as a Base32Hex string into a caller provided buffer, e.g. a memory mapped
+ * file, on several threads if they are large enough.
+ *
+ * @param[in] a_data Bytes to encode.
+ * @param[out] a_out Buffer to write the encoded string into. Has to hold at least
+ * `base32_encoded_size(a_data.size(), a_padding)` characters.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs, e.g. if the buffer is
+ * too small.
+ * @param[in] a_options Executor and size threshold to use.
+ * @param[in] a_padding Should the string be padded at the end with the given padding character, if
+ * it's too short.
+ * @param[in] a_pad_character Character to use as padding.
+ *
+ * @returns std::size_t Number of characters written. 0 if an error occurred.
+ */
+inline auto base32hex_encode_into(
+    std::span<std::uint8_t const> a_data,
+    std::span<char> a_out,
+    std::error_code& a_ec,
+    parallel_options const& a_options,
+    bool a_padding = true,
+    char a_pad_character = '='
+)
+-> std::size_t
+{
+    auto const size = base32_encoded_size(a_data.size(), a_padding);
+
+    if (a_out.size() < size)
+    {
+        a_ec = std::make_error_code(std::errc::no_buffer_space);
+        return 0;
+    }
+
+    detail::encode_parallel<base32hex_alphabet>(
+        a_data,
+        a_out.data(),
+        a_padding,
+        a_pad_character,
+        a_options
+    );
+    return size;
+}
+
+/**
+ * @brief Encodes bytes as a Base64 string into a caller provided buffer, e.g. a memory mapped
+ * file, on several threads if they are large enough.
+ *
+ * @param[in] a_data Bytes to encode.
+ * @param[out] a_out Buffer to write the encoded string into. Has to hold at least
+ * `base64_encoded_size(a_data.size(), a_padding)` characters.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs, e.g. if the buffer is
+ * too small.
+ * @param[in] a_options Executor and size threshold to use.
+ * @param[in] a_padding Should the string be padded at the end with the given padding character, if
+ * it's too short.
+ * @param[in] a_pad_character Character to use as padding.
+ *
+ * @returns std::size_t Number of characters written. 0 if an error occurred.
+ */
+inline auto base64_encode_into(
+    std::span<std::uint8_t const> a_data,
+    std::span<char> a_out,
+    std::error_code& a_ec,
+    parallel_options const& a_options,
+    bool a_padding = true,
+    char a_pad_character = '='
+)
+-> std::size_t
+{
+    auto const size = base64_encoded_size(a_data.size(), a_padding);
+
+    if (a_out.size() < size)
+    {
+        a_ec = std::make_error_code(std::errc::no_buffer_space);
+        return 0;
+    }
+
+    detail::encode_parallel<base64_alphabet>(
+        a_data,
+        a_out.data(),
+        a_padding,
+        a_pad_character,
+        a_options
+    );
+    return size;
+}
+
+/**
+ * @brief Encodes bytes as a Base64Url string into a caller provided buffer, e.g. a memory mapped
+ * file, on several threads if they are large enough.
+ *
+ * @param[in] a_data Bytes to encode.
+ * @param[out] a_out Buffer to write the encoded string into. Has to hold at least
+ * `base64_encoded_size(a_data.size(), a_padding)` characters.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs, e.g. if the buffer is
+ * too small.
+ * @param[in] a_options Executor and size threshold to use.
+ * @param[in] a_padding Should the string be padded at the end with the given padding character, if
+ * it's too short.
+ * @param[in] a_pad_character Character to use as padding.
+ *
+ * @returns std::size_t Number of characters written. 0 if an error occurred.
+ */
+inline auto base64url_encode_into(
+    std::span<std::uint8_t const> a_data,
+    std::span<char> a_out,
+    std::error_code& a_ec,
+    parallel_options const& a_options,
+    bool a_padding = false,
+    char a_pad_character = '='
+)
+-> std::size_t
+{
+    auto const size = base64_encoded_size(a_data.size(), a_padding);
+
+    if (a_out.size() < size)
+    {
+        a_ec = std::make_error_code(std::errc::no_buffer_space);
+        return 0;
+    }
+
+    detail::encode_parallel<base64url_alphabet>(
+        a_data,
+        a_out.data(),
+        a_padding,
+        a_pad_character,
+        a_options
+    );
+    return size;
+}
+
+/**
+ * @brief Decodes a Base16 encoded string into a caller provided buffer, on several threads if
+ * it is large enough.
+ *
+ * @param[in] a_data Base16 encoded string to decode.
+ * @param[out] a_out Buffer to write the decoded bytes into. Has to hold at least
+ * `base16_decoded_size(a_data)` bytes.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs, e.g. if the buffer is
+ * too small.
+ * @param[in] a_options Executor and size threshold to use.
+ * @param[in] a_strict Enable/disable strict mode, see `base16_decode`.
+ *
+ * @returns std::size_t Number of bytes written. 0 if an error occurred.
+ */
+inline auto base16_decode_into(
+    std::string_view const& a_data,
+    std::span<std::uint8_t> a_out,
+    std::error_code& a_ec,
+    parallel_options const& a_options,
+    bool a_strict = true
+)
+-> std::size_t
+{
+    if (a_out.size() < base16_decoded_size(a_data))
+    {
+        a_ec = std::make_error_code(std::errc::no_buffer_space);
+        return 0;
+    }
+
+    return detail::decode_parallel<base16_alphabet>(
+        a_data,
+        a_out.data(),
+        a_ec,
+        a_strict,
+        '\0',
+        a_options
+    );
+}
+
+/**
+ * @brief Decodes a Base32 encoded string into a caller provided buffer, on several threads if
+ * it is large enough.
+ *
+ * @param[in] a_data Base32 encoded string to decode.
+ * @param[out] a_out Buffer to write the decoded bytes into. Has to hold at least
+ * `base32_decoded_size(a_data, a_pad_character)` bytes.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs, e.g. if the buffer is
+ * too small.
+ * @param[in] a_options Executor and size threshold to use.
+ * @param[in] a_strict Enable/disable strict mode, see `base32_decode`.
+ * @param[in] a_pad_character Character to recognize as a padding character.
+ *
+ * @returns std::size_t Number of bytes written. 0 if an error occurred.
+ */
+inline auto base32_decode_into(
+    std::string_view const& a_data,
+    std::span<std::uint8_t> a_out,
+    std::error_code& a_ec,
+    parallel_options const& a_options,
+    bool a_strict = true,
+    char a_pad_character = '='
+)
+-> std::size_t
+{
+    if (a_out.size() < base32_decoded_size(a_data, a_pad_character))
+    {
+        a_ec = std::make_error_code(std::errc::no_buffer_space);
+        return 0;
+    }
+
+    return detail::decode_parallel<base32_alphabet>(
+        a_data,
+        a_out.data(),
+        a_ec,
+        a_strict,
+        a_pad_character,
+        a_options
+    );
+}
+
+/**
+ * @brief Decodes a Base32Hex encoded string into a caller provided buffer, on several threads if
+ * it is large enough.
+ *
+ * @param[in] a_data Base32Hex encoded string to decode.
+ * @param[out] a_out Buffer to write the decoded bytes into. Has to hold at least
+ * `base32_decoded_size(a_data, a_pad_character)` bytes.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs, e.g. if the buffer is
+ * too small.
+ * @param[in] a_options Executor and size threshold to use.
+ * @param[in] a_strict Enable/disable strict mode, see `base32hex_decode`.
+ * @param[in] a_pad_character Character to recognize as a padding character.
+ *
+ * @returns std::size_t Number of bytes written. 0 if an error occurred.
+ */
+inline auto base32hex_decode_into(
+    std::string_view const& a_data,
+    std::span<std::uint8_t> a_out,
+    std::error_code& a_ec,
+    parallel_options const& a_options,
+    bool a_strict = true,
+    char a_pad_character = '='
+)
+-> std::size_t
+{
+    if (a_out.size() < base32_decoded_size(a_data, a_pad_character))
+    {
+        a_ec = std::make_error_code(std::errc::no_buffer_space);
+        return 0;
+    }
+
+    return detail::decode_parallel<base32hex_alphabet>(
+        a_data,
+        a_out.data(),
+        a_ec,
+        a_strict,
+        a_pad_character,
+        a_options
+    );
+}
+
+/**
+ * @brief Decodes a Base64 encoded string into a caller provided buffer, on several threads if
+ * it is large enough.
+ *
+ * @param[in] a_data Base64 encoded string to decode.
+ * @param[out] a_out Buffer to write the decoded bytes into. Has to hold at least
+ * `base64_decoded_size(a_data, a_pad_character)` bytes.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs, e.g. if the buffer is
+ * too small.
+ * @param[in] a_options Executor and size threshold to use.
+ * @param[in] a_strict Enable/disable strict mode, see `base64_decode`.
+ * @param[in] a_pad_character Character to recognize as a padding character.
+ *
+ * @returns std::size_t Number of bytes written. 0 if an error occurred.
+ */
+inline auto base64_decode_into(
+    std::string_view const& a_data,
+    std::span<std::uint8_t> a_out,
+    std::error_code& a_ec,
+    parallel_options const& a_options,
+    bool a_strict = true,
+    char a_pad_character = '='
+)
+-> std::size_t
+{
+    if (a_out.size() < base64_decoded_size(a_data, a_pad_character))
+    {
+        a_ec = std::make_error_code(std::errc::no_buffer_space);
+        return 0;
+    }
+
+    return detail::decode_parallel<base64_alphabet>(
+        a_data,
+        a_out.data(),
+        a_ec,
+        a_strict,
+        a_pad_character,
+        a_options
+    );
+}
+
+/**
+ * @brief Decodes a Base64Url encoded string into a caller provided buffer, on several threads if
+ * it is large enough.
+ *
+ * @param[in] a_data Base64Url encoded string to decode.
+ * @param[out] a_out Buffer to write the decoded bytes into. Has to hold at least
+ * `base64_decoded_size(a_data, a_pad_character)` bytes.
+ * @param[in][out] a_ec std::error_code that gets set if a problem occurs, e.g. if the buffer is
+ * too small.
+ * @param[in] a_options Executor and size threshold to use.
+ * @param[in] a_strict Enable/disable strict mode, see `base64url_decode`.
+ * @param[in] a_pad_character Character to recognize as a padding character.
+ *
+ * @returns std::size_t Number of bytes written. 0 if an error occurred.
+ */
+inline auto base64url_decode_into(
+    std::string_view const& a_data,
+    std::span<std::uint8_t> a_out,
+    std::error_code& a_ec,
+    parallel_options const& a_options,
+    bool a_strict = true,
+    char a_pad_character = '='
+)
+-> std::size_t
+{
+    if (a_out.size() < base64_decoded_size(a_data, a_pad_character))
+    {
+        a_ec = std::make_error_code(std::errc::no_buffer_space);
+        return 0;
+    }
+
+    return detail::decode_parallel<base64url_alphabet>(
+        a_data,
+        a_out.data(),
+        a_ec,
+        a_strict,
+        a_pad_character,
+        a_options
+    );
+}
+
+}   // namespace base_codec
+}   // namespace rs
@@ -0,0 +1,210 @@
+/**
+ * @file pipeline.hpp
+ *
+ * Transcoding of whole files through the streaming encoders and decoders, with the reads, the
+ * transcoding and the writes of consecutive blocks overlapping. On Linux the I/O goes through
+ * io_uring with registered buffers, elsewhere (or when io_uring is unavailable) through a reader
+ * and a writer thread.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <system_error>
+
+
+namespace rs
+{
+namespace base_codec
+{
+
+/**
+ * @brief Options of a `file_pipeline`.
+ */
+struct pipeline_options
+{
+    /**
+     * Number of bytes read per block.
+     */
+    std::size_t block_size = std::size_t {1} << 20;
+
+    /**
+     * Number of blocks in flight at once - 2 for double buffering, 3 for triple buffering.
+     */
+    std::size_t buffers = 3;
+
+    /**
+     * Number of io_uring submission queue entries. Raised to `buffers` if lower.
+     */
+    unsigned queue_depth = 8;
+
+    /**
+     * Use io_uring where the kernel supports it. If false, the reader/writer threads are used.
+     */
+    bool io_uring = true;
+};
+
+namespace detail
+{
+
+/**
+ * Type erased streaming encoder or decoder, working on raw bytes either way.
+ */
+struct transcode_step
+{
+    std::function<std::size_t(std::size_t)> max_update_size;
+    std::function<
+        std::size_t(std::span<std::uint8_t const>, std::span<std::uint8_t>, std::error_code&)
+    > update;
+    std::function<std::size_t(std::span<std::uint8_t>, std::error_code&)> finish;
+};
+
+template <typename Transcoder>
+auto make_transcode_step(Transcoder& a_transcoder) -> transcode_step
+{
+    transcode_step ret;
+    ret.max_update_size = [&](std::size_t a_size) { return a_transcoder.max_update_size(a_size); };
+
+    // NOTE - Encoders take bytes and write characters, decoders the other way around. Only the
+    //        encoders write anything when they finish.
+    if constexpr (requires(std::span<char> a_out, std::error_code& a_ec) {
+        a_transcoder.finish(a_out, a_ec);
+    })
+    {
+        ret.update = [&](
+            std::span<std::uint8_t const> a_in,
+            std::span<std::uint8_t> a_out,
+            std::error_code& a_ec
+        )
+        {
+            return a_transcoder.update(
+                a_in,
+                std::span<char>(reinterpret_cast<char*>(a_out.data()), a_out.size()),
+                a_ec
+            );
+        };
+        ret.finish = [&](std::span<std::uint8_t> a_out, std::error_code& a_ec)
+        {
+            return a_transcoder.finish(
+                std::span<char>(reinterpret_cast<char*>(a_out.data()), a_out.size()),
+                a_ec
+            );
+        };
+    } else
+    {
+        ret.update = [&](
+            std::span<std::uint8_t const> a_in,
+            std::span<std::uint8_t> a_out,
+            std::error_code& a_ec
+        )
+        {
+            return a_transcoder.update(
+                std::string_view(reinterpret_cast<char const*>(a_in.data()), a_in.size()),
+                a_out,
+                a_ec
+            );
+        };
+        ret.finish = [&](std::span<std::uint8_t> /* a_out */, std::error_code& a_ec)
+        {
+            a_transcoder.finish(a_ec);
+            return std::size_t {0};
+        };
+    }
+
+    return ret;
+}
+
+}   // namespace detail
+
+/**
+ * @brief Transcodes files through any of the streaming encoders and decoders (`base64_encoder`,
+ * `base32_decoder`, ...), overlapping the I/O of some blocks with the transcoding of another.
+ *
+ * The buffers (and the io_uring instance with them registered) are set up once and reused for
+ * every file, so a batch job should keep one pipeline per thread. A pipeline is not thread safe.
+ */
+class file_pipeline
+{
+public:
+    explicit file_pipeline(pipeline_options const& a_options = {});
+
+    file_pipeline(file_pipeline const&) = delete;
+    auto operator=(file_pipeline const&) -> file_pipeline& = delete;
+
+    ~file_pipeline();
+
+    /**
+     * @brief Returns true if the pipeline runs on io_uring, false if on reader/writer threads.
+     */
+    auto uses_io_uring() const -> bool;
+
+    /**
+     * @brief Transcodes everything readable from one file descriptor to another. Regular files
+     * are read and written at explicit offsets from their start, anything else (pipes, sockets)
+     * in order, one operation at a time.
+     *
+     * @param[in] a_in Descriptor to read from.
+     * @param[in] a_out Descriptor to write to.
+     * @param[in][out] a_transcoder Streaming encoder or decoder to run the data through. It gets
+     * finished at the end of the input. The output buffers get grown to its `max_update_size` of a
+     * block if that's larger than they are, and `finish` has to fit into the same room.
+     * @param[in][out] a_ec std::error_code that gets set if an I/O or decoding error occurs.
+     *
+     * @returns std::uint64_t Number of bytes written.
+     */
+    template <typename Transcoder>
+    auto transcode(
+        int a_in,
+        int a_out,
+        Transcoder& a_transcoder,
+        std::error_code& a_ec
+    )
+    -> std::uint64_t
+    {
+        return run(a_in, a_out, detail::make_transcode_step(a_transcoder), a_ec);
+    }
+
+    /**
+     * @brief Transcodes one file into another, which gets created or truncated.
+     */
+    template <typename Transcoder>
+    auto transcode(
+        std::filesystem::path const& a_in,
+        std::filesystem::path const& a_out,
+        Transcoder& a_transcoder,
+        std::error_code& a_ec
+    )
+    -> std::uint64_t
+    {
+        return run(a_in, a_out, detail::make_transcode_step(a_transcoder), a_ec);
+    }
+
+private:
+    struct state;
+
+    auto run(
+        int a_in,
+        int a_out,
+        detail::transcode_step const& a_step,
+        std::error_code& a_ec
+    )
+    -> std::uint64_t;
+
+    auto run(
+        std::filesystem::path const& a_in,
+        std::filesystem::path const& a_out,
+        detail::transcode_step const& a_step,
+        std::error_code& a_ec
+    )
+    -> std::uint64_t;
+
+    std::unique_ptr<state> m_state;
+};
+
+}   // namespace base_codec
+}   // namespace rs
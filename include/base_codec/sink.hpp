@@ -0,0 +1,67 @@
+/**
+ * @file sink.hpp
+ *
+ * Helpers behind the encoders that write into output iterators and chunked callbacks.
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <system_error>
+
+
+namespace rs
+{
+namespace base_codec
+{
+namespace detail
+{
+
+/**
+ * Size of the stack buffer the sink encoders go through, in characters.
+ */
+inline constexpr std::size_t sink_buffer_size = 4096;
+
+/**
+ * Encodes the data a buffer full at a time and hands every encoded chunk to the callback. Every
+ * chunk but the last is made of whole blocks, so padding only ever ends up in the last one.
+ *
+ * `a_encode` is called as `a_encode(std::span<std::uint8_t const>, std::span<char>,
+ * std::error_code&)` and returns the number of characters written, like the `*_encode_into`
+ * routines.
+ */
+template <std::size_t BlockSize, std::size_t SymbolsPerBlock, typename Encoder, typename Callback>
+auto encode_in_chunks(
+    std::span<std::uint8_t const> a_data,
+    std::error_code& a_ec,
+    Encoder&& a_encode,
+    Callback&& a_callback
+)
+-> void
+{
+    constexpr auto chunk_blocks = sink_buffer_size / SymbolsPerBlock;
+
+    std::array<char, chunk_blocks * SymbolsPerBlock> buffer;
+
+    while (!a_data.empty())
+    {
+        auto const chunk = a_data.first(std::min(a_data.size(), chunk_blocks * BlockSize));
+        auto const written = a_encode(chunk, std::span<char>(buffer), a_ec);
+
+        if (a_ec)
+        {
+            return;
+        }
+
+        a_callback(std::string_view(buffer.data(), written));
+        a_data = a_data.subspan(chunk.size());
+    }
+}
+
+}   // namespace detail
+}   // namespace base_codec
+}   // namespace rs
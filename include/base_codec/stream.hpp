@@ -0,0 +1,43 @@
+/**
+ * @file stream.hpp
+ *
+ * State carried across chunk boundaries by the streaming encoder/decoder objects of the codecs.
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace rs
+{
+namespace base_codec
+{
+namespace detail
+{
+
+/**
+ * Bytes of a partial block held back by an encoder until the next chunk (or the end) arrives.
+ * Five bytes is the largest block of all the codecs (Base32).
+ */
+struct encoder_state
+{
+    std::array<std::uint8_t, 5> carry {};
+    std::size_t carry_size = 0;
+};
+
+/**
+ * Bits of a partial byte held by a decoder between chunks, and whether padding has been seen -
+ * everything after it gets ignored, like the one-shot decoders do.
+ */
+struct decoder_state
+{
+    std::uint64_t bit_buffer = 0;
+    std::uint32_t num_bits = 0;
+    bool padded = false;
+};
+
+}   // namespace detail
+}   // namespace base_codec
+}   // namespace rs
@@ -0,0 +1,334 @@
+/**
+ * @file streambuf.hpp
+ *
+ * `std::streambuf` adapters which encode or decode on the fly while passing data through to
+ * another stream buffer, so `std::istream` / `std::ostream` code can be pointed at Base16, Base32
+ * or Base64 data without ever holding all of it in memory.
+ */
+#pragma once
+
+#include <base_codec/base16.hpp>
+#include <base_codec/base32.hpp>
+#include <base_codec/base64.hpp>
+
+#include <algorithm>
+#include <array>
+#include <span>
+#include <streambuf>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <system_error>
+
+
+namespace rs
+{
+namespace base_codec
+{
+
+/**
+ * @brief Output stream buffer that encodes everything written to it and writes the encoding to
+ * another stream buffer.
+ *
+ * Bytes are collected in a fixed internal buffer and encoded a whole buffer at a time, large
+ * writes are encoded straight from the caller's memory. `finish()` writes the last partial block
+ * and its padding - it's called by the destructor as well, but only an explicit call reports
+ * errors.
+ *
+ * @tparam Encoder One of the streaming encoders, e.g. `base64_encoder`.
+ */
+template <typename Encoder>
+class basic_encoding_ostreambuf : public std::streambuf
+{
+public:
+    /**
+     * @param[in] a_sink Stream buffer the encoding is written to. Has to outlive this object.
+     * @param[in] a_encoder Encoder to use, which selects the padding options.
+     */
+    explicit basic_encoding_ostreambuf(
+        std::streambuf* a_sink,
+        Encoder a_encoder = Encoder()
+    )
+        : m_sink(a_sink)
+        , m_encoder(a_encoder)
+    {
+        reset_put_area();
+    }
+
+    basic_encoding_ostreambuf(basic_encoding_ostreambuf const&) = delete;
+    auto operator=(basic_encoding_ostreambuf const&) -> basic_encoding_ostreambuf& = delete;
+
+    ~basic_encoding_ostreambuf() override
+    {
+        if (!m_finished)
+        {
+            std::error_code ec;
+            finish(ec);
+        }
+    }
+
+    /**
+     * @brief Encodes whatever is still buffered, writes the end of the encoding and flushes the
+     * sink. Writing more data afterwards starts a new encoding.
+     *
+     * @param[in][out] a_ec std::error_code that gets set if the sink doesn't take all the data.
+     */
+    auto finish(std::error_code& a_ec) -> void
+    {
+        if (!flush_put_area())
+        {
+            a_ec = std::make_error_code(std::errc::io_error);
+            return;
+        }
+
+        auto const written = m_encoder.finish(std::span<char>(m_encoded), a_ec);
+        m_finished = true;
+
+        if (!write(written) || m_sink->pubsync() == -1)
+        {
+            a_ec = std::make_error_code(std::errc::io_error);
+        }
+    }
+
+protected:
+    auto overflow(int_type a_character) -> int_type override
+    {
+        if (!flush_put_area())
+        {
+            return traits_type::eof();
+        }
+
+        if (traits_type::eq_int_type(a_character, traits_type::eof()))
+        {
+            return traits_type::not_eof(a_character);
+        }
+
+        *pptr() = traits_type::to_char_type(a_character);
+        pbump(1);
+
+        return a_character;
+    }
+
+    auto xsputn(char_type const* a_data, std::streamsize a_size) -> std::streamsize override
+    {
+        // NOTE - Small writes go through the put area, anything bigger than it gets encoded
+        //        directly, one buffer's worth at a time.
+        if (a_size < epptr() - pptr())
+        {
+            return std::streambuf::xsputn(a_data, a_size);
+        }
+
+        if (!flush_put_area())
+        {
+            return 0;
+        }
+
+        auto const* data = reinterpret_cast<std::uint8_t const*>(a_data);
+        std::streamsize done = 0;
+
+        while (done < a_size)
+        {
+            auto const chunk = std::min<std::streamsize>(a_size - done, buffer_size);
+
+            if (!encode(std::span(data + done, static_cast<std::size_t>(chunk))))
+            {
+                break;
+            }
+
+            done += chunk;
+        }
+
+        return done;
+    }
+
+    auto sync() -> int override
+    {
+        if (!flush_put_area())
+        {
+            return -1;
+        }
+
+        return m_sink->pubsync();
+    }
+
+private:
+    static constexpr std::size_t buffer_size = 3840;
+
+    auto reset_put_area() -> void
+    {
+        setp(m_buffer.data(), m_buffer.data() + m_buffer.size());
+    }
+
+    auto flush_put_area() -> bool
+    {
+        auto const size = static_cast<std::size_t>(pptr() - pbase());
+        reset_put_area();
+
+        return encode(std::span(reinterpret_cast<std::uint8_t const*>(m_buffer.data()), size));
+    }
+
+    auto encode(std::span<std::uint8_t const> a_data) -> bool
+    {
+        m_finished = m_finished && a_data.empty();
+
+        std::error_code ec;
+        auto const written = m_encoder.update(a_data, std::span<char>(m_encoded), ec);
+
+        return !ec && write(written);
+    }
+
+    auto write(std::size_t a_size) -> bool
+    {
+        auto const size = static_cast<std::streamsize>(a_size);
+        return m_sink->sputn(m_encoded.data(), size) == size;
+    }
+
+    std::streambuf* m_sink;
+    Encoder m_encoder;
+    bool m_finished = false;
+    // NOTE - Divisible by every block size, and Base16 doubles the size at most.
+    std::array<char, buffer_size> m_buffer;
+    std::array<char, buffer_size * 2 + 8> m_encoded;
+};
+
+/**
+ * @brief Input stream buffer that reads encoded characters from another stream buffer and hands
+ * out the decoded bytes.
+ *
+ * The source is read a fixed size chunk at a time. The decoded stream ends with the source, or
+ * right before the first error, which can be checked with `error()`.
+ *
+ * @tparam Decoder One of the streaming decoders, e.g. `base64_decoder`.
+ */
+template <typename Decoder>
+class basic_decoding_istreambuf : public std::streambuf
+{
+public:
+    /**
+     * @param[in] a_source Stream buffer the encoding is read from. Has to outlive this object.
+     * @param[in] a_decoder Decoder to use, which selects strict or lenient mode.
+     */
+    explicit basic_decoding_istreambuf(
+        std::streambuf* a_source,
+        Decoder a_decoder = Decoder()
+    )
+        : m_source(a_source)
+        , m_decoder(a_decoder)
+    {
+        setg(m_decoded.data(), m_decoded.data(), m_decoded.data());
+    }
+
+    basic_decoding_istreambuf(basic_decoding_istreambuf const&) = delete;
+    auto operator=(basic_decoding_istreambuf const&) -> basic_decoding_istreambuf& = delete;
+
+    /**
+     * @brief Returns the error that ended the decoded stream early, if any.
+     */
+    auto error() const -> std::error_code
+    {
+        return m_ec;
+    }
+
+protected:
+    auto underflow() -> int_type override
+    {
+        // NOTE - A chunk can decode to nothing (a lone character, or only skipped ones), so keep
+        //        reading until there is something to hand out or the source runs dry.
+        while (gptr() == egptr() && !m_done)
+        {
+            auto const read = m_source->sgetn(m_encoded.data(), buffer_size);
+
+            if (read <= 0)
+            {
+                m_decoder.finish(m_ec);
+                m_done = true;
+                break;
+            }
+
+            auto const encoded = std::string_view(m_encoded.data(), static_cast<std::size_t>(read));
+            auto const previous = m_decoder;
+            auto written = m_decoder.update(
+                encoded,
+                std::span(reinterpret_cast<std::uint8_t*>(m_decoded.data()), m_decoded.size()),
+                m_ec
+            );
+
+            if (m_ec)
+            {
+                written = decode_until_error(previous, encoded);
+                m_done = true;
+            }
+
+            setg(m_decoded.data(), m_decoded.data(), m_decoded.data() + written);
+        }
+
+        if (gptr() == egptr())
+        {
+            return traits_type::eof();
+        }
+
+        return traits_type::to_int_type(*gptr());
+    }
+
+private:
+    static constexpr std::size_t buffer_size = 4096;
+
+    /**
+     * The decoders report nothing of a chunk holding an invalid character, so it gets decoded
+     * again a character at a time from the state before it, to keep the bytes before the error.
+     */
+    auto decode_until_error(
+        Decoder const& a_previous,
+        std::string_view a_encoded
+    )
+    -> std::size_t
+    {
+        m_decoder = a_previous;
+        std::size_t out = 0;
+
+        for (auto const datum : a_encoded)
+        {
+            std::error_code ec;
+            auto const written = m_decoder.update(
+                std::string_view(&datum, 1),
+                std::span(
+                    reinterpret_cast<std::uint8_t*>(m_decoded.data()) + out,
+                    m_decoded.size() - out
+                ),
+                ec
+            );
+
+            if (ec)
+            {
+                break;
+            }
+
+            out += written;
+        }
+
+        return out;
+    }
+
+    std::streambuf* m_source;
+    Decoder m_decoder;
+    std::error_code m_ec;
+    bool m_done = false;
+    std::array<char, buffer_size> m_encoded;
+    // NOTE - Every codec decodes to fewer bytes than it reads characters.
+    std::array<char, buffer_size> m_decoded;
+};
+
+using base16_ostreambuf = basic_encoding_ostreambuf<base16_encoder>;
+using base32_ostreambuf = basic_encoding_ostreambuf<base32_encoder>;
+using base32hex_ostreambuf = basic_encoding_ostreambuf<base32hex_encoder>;
+using base64_ostreambuf = basic_encoding_ostreambuf<base64_encoder>;
+using base64url_ostreambuf = basic_encoding_ostreambuf<base64url_encoder>;
+
+using base16_istreambuf = basic_decoding_istreambuf<base16_decoder>;
+using base32_istreambuf = basic_decoding_istreambuf<base32_decoder>;
+using base32hex_istreambuf = basic_decoding_istreambuf<base32hex_decoder>;
+using base64_istreambuf = basic_decoding_istreambuf<base64_decoder>;
+using base64url_istreambuf = basic_decoding_istreambuf<base64url_decoder>;
+
+}   // namespace base_codec
+}   // namespace rs
@@ -0,0 +1,35 @@
+/**
+ * @file validation.hpp
+ *
+ * Types shared by the validation routines of all the codecs.
+ */
+#pragma once
+
+#include <cstddef>
+
+
+namespace rs
+{
+namespace base_codec
+{
+
+/**
+ * @brief Describes the first problem found while validating an encoded string.
+ */
+struct validation_error
+{
+    /**
+     * Offset of the first character that can't be where it is - a character outside the
+     * alphabet, or a misplaced padding character. Equals the size of the string when it is the
+     * length that is wrong (e.g. a truncated last block or missing padding).
+     */
+    std::size_t offset = 0;
+
+    /**
+     * The offending character, or '\0' when the length is wrong.
+     */
+    char value = '\0';
+};
+
+}   // namespace base_codec
+}   // namespace rs
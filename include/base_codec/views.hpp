@@ -0,0 +1,396 @@
+/**
+ * @file views.hpp
+ *
+ * Lazy range adaptors which encode or decode on demand while iterating, e.g.
+ *
+ *     auto magic = payload | rs::base_codec::views::base64_decode | std::views::take(4);
+ *
+ * only decodes the first chunk of `payload`. Input is pulled a chunk at a time and run through the
+ * same kernels as the one-shot routines - straight from memory when the input is contiguous, and
+ * through a small copy otherwise.
+ */
+#pragma once
+
+#include <base_codec/base16.hpp>
+#include <base_codec/base32.hpp>
+#include <base_codec/base64.hpp>
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+
+namespace rs
+{
+namespace base_codec
+{
+namespace detail
+{
+
+/**
+ * Adapts a streaming encoder to `transcode_view`.
+ */
+template <typename Encoder>
+struct encode_policy
+{
+    using state_type = Encoder;
+    using input_type = std::uint8_t;
+    using output_type = char;
+
+    // NOTE - Divisible by every block size, so only the last chunk leaves a partial block.
+    static constexpr std::size_t input_chunk = 240;
+    static constexpr std::size_t output_capacity = input_chunk * 2 + 8;
+
+    static auto update(
+        state_type& a_state,
+        std::span<input_type const> a_in,
+        output_type* a_out,
+        std::error_code& a_ec
+    )
+    -> std::size_t
+    {
+        return a_state.update(a_in, std::span(a_out, output_capacity), a_ec);
+    }
+
+    static auto finish(
+        state_type& a_state,
+        output_type* a_out,
+        std::error_code& a_ec
+    )
+    -> std::size_t
+    {
+        return a_state.finish(std::span(a_out, output_capacity), a_ec);
+    }
+};
+
+/**
+ * Adapts a streaming decoder to `transcode_view`.
+ */
+template <typename Decoder>
+struct decode_policy
+{
+    using state_type = Decoder;
+    using input_type = char;
+    using output_type = std::uint8_t;
+
+    static constexpr std::size_t input_chunk = 256;
+    static constexpr std::size_t output_capacity = input_chunk;
+
+    static auto update(
+        state_type& a_state,
+        std::span<input_type const> a_in,
+        output_type* a_out,
+        std::error_code& a_ec
+    )
+    -> std::size_t
+    {
+        auto const previous = a_state;
+        auto const ret = a_state.update(
+            std::string_view(a_in.data(), a_in.size()),
+            std::span(a_out, output_capacity),
+            a_ec
+        );
+
+        if (!a_ec)
+        {
+            return ret;
+        }
+
+        // NOTE - The decoders report nothing of a chunk holding an invalid character, so it gets
+        //        decoded again a character at a time to keep the bytes before the error.
+        a_state = previous;
+        std::size_t out = 0;
+
+        for (auto const datum : a_in)
+        {
+            std::error_code ec;
+            auto const written = a_state.update(
+                std::string_view(&datum, 1),
+                std::span(a_out + out, output_capacity - out),
+                ec
+            );
+
+            if (ec)
+            {
+                break;
+            }
+
+            out += written;
+        }
+
+        return out;
+    }
+
+    static auto finish(
+        state_type& a_state,
+        output_type* /* a_out */,
+        std::error_code& a_ec
+    )
+    -> std::size_t
+    {
+        a_state.finish(a_ec);
+        return 0;
+    }
+};
+
+/**
+ * Input ranges of byte sized elements, which the views can reinterpret as bytes or characters.
+ */
+template <typename Range>
+concept byte_input_range = std::ranges::input_range<Range> &&
+                           sizeof(std::ranges::range_value_t<Range>) == 1 &&
+                           (std::is_integral_v<std::ranges::range_value_t<Range>> ||
+                            std::is_same_v<std::ranges::range_value_t<Range>, std::byte>);
+
+/**
+ * View which transcodes the underlying range a chunk at a time, as the iterator reaches the end of
+ * the previous one. The iterator holds the output of a single chunk, so this is an input range -
+ * every pass has to start from a fresh `begin()`.
+ *
+ * The output ends right before the first error, which `error()` reports once iteration got there.
+ */
+template <std::ranges::view View, typename Policy>
+class transcode_view : public std::ranges::view_interface<transcode_view<View, Policy>>
+{
+public:
+    class iterator
+    {
+    public:
+        using iterator_concept = std::input_iterator_tag;
+        using value_type = typename Policy::output_type;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+
+        iterator(
+            std::ranges::iterator_t<View> a_current,
+            std::ranges::sentinel_t<View> a_end,
+            std::shared_ptr<std::error_code> a_error
+        )
+            : m_current(std::move(a_current))
+            , m_end(std::move(a_end))
+            , m_error(std::move(a_error))
+        {
+            fill();
+        }
+
+        auto operator*() const -> value_type
+        {
+            return m_buffer[m_pos];
+        }
+
+        auto operator++() -> iterator&
+        {
+            if (++m_pos == m_size)
+            {
+                fill();
+            }
+
+            return *this;
+        }
+
+        auto operator++(int) -> void
+        {
+            ++*this;
+        }
+
+        friend auto operator==(
+            iterator const& a_iterator,
+            std::default_sentinel_t
+        )
+        -> bool
+        {
+            return a_iterator.m_pos == a_iterator.m_size && a_iterator.m_finished;
+        }
+
+    private:
+        using input_type = typename Policy::input_type;
+
+        auto fill() -> void
+        {
+            m_pos = 0;
+            m_size = 0;
+
+            // NOTE - A chunk can transcode to nothing (a partial block, or only skipped
+            //        characters), so keep pulling until there is output or the input runs dry.
+            while (m_size == 0 && !m_finished)
+            {
+                std::error_code ec;
+
+                if (m_current == m_end)
+                {
+                    m_size = Policy::finish(m_state, m_buffer.data(), ec);
+                    m_finished = true;
+                } else
+                {
+                    m_size = Policy::update(m_state, next_chunk(), m_buffer.data(), ec);
+                }
+
+                // NOTE - The output ends with what was decoded before the first error.
+                if (ec)
+                {
+                    m_finished = true;
+
+                    if (m_error)
+                    {
+                        *m_error = ec;
+                    }
+                }
+            }
+        }
+
+        auto next_chunk() -> std::span<input_type const>
+        {
+            if constexpr (std::contiguous_iterator<std::ranges::iterator_t<View>> &&
+                          std::sized_sentinel_for<
+                              std::ranges::sentinel_t<View>,
+                              std::ranges::iterator_t<View>
+                          >)
+            {
+                auto const size = std::min<std::size_t>(
+                    static_cast<std::size_t>(m_end - m_current),
+                    Policy::input_chunk
+                );
+                auto const* data = reinterpret_cast<input_type const*>(
+                    std::to_address(m_current)
+                );
+                m_current += static_cast<std::ranges::range_difference_t<View>>(size);
+
+                return {data, size};
+            } else
+            {
+                std::size_t size = 0;
+
+                for (; size < Policy::input_chunk && m_current != m_end; ++size, ++m_current)
+                {
+                    m_chunk[size] = static_cast<input_type>(*m_current);
+                }
+
+                return {m_chunk.data(), size};
+            }
+        }
+
+        std::ranges::iterator_t<View> m_current {};
+        std::ranges::sentinel_t<View> m_end {};
+        std::shared_ptr<std::error_code> m_error;
+        typename Policy::state_type m_state {};
+        bool m_finished = false;
+        std::size_t m_pos = 0;
+        std::size_t m_size = 0;
+        std::array<typename Policy::output_type, Policy::output_capacity> m_buffer;
+        // NOTE - Only used to gather input from ranges that aren't contiguous.
+        std::array<input_type, Policy::input_chunk> m_chunk;
+    };
+
+    transcode_view() requires std::default_initializable<View> = default;
+
+    explicit transcode_view(View a_base)
+        : m_base(std::move(a_base))
+    {
+    }
+
+    auto base() const& -> View requires std::copy_constructible<View>
+    {
+        return m_base;
+    }
+
+    auto base() && -> View
+    {
+        return std::move(m_base);
+    }
+
+    // NOTE - The error lives apart from the view, so the view can be moved while it's iterated.
+    auto begin() -> iterator
+    {
+        m_error = std::make_shared<std::error_code>();
+        return iterator(std::ranges::begin(m_base), std::ranges::end(m_base), m_error);
+    }
+
+    auto end() const -> std::default_sentinel_t
+    {
+        return std::default_sentinel;
+    }
+
+    /**
+     * @brief Returns the error that ended the last pass over the view, e.g.
+     * `std::errc::invalid_argument` for an invalid character. Empty if there was none (yet).
+     */
+    auto error() const -> std::error_code
+    {
+        return m_error ? *m_error : std::error_code {};
+    }
+
+private:
+    View m_base {};
+    std::shared_ptr<std::error_code> m_error;
+};
+
+/**
+ * Range adaptor object behind the views, usable as `views::x(range)` or `range | views::x`.
+ */
+template <typename Policy>
+struct transcode_adaptor
+{
+    template <std::ranges::viewable_range Range>
+    requires byte_input_range<Range>
+    auto operator()(Range&& a_range) const
+    {
+        return transcode_view<std::views::all_t<Range>, Policy>(
+            std::views::all(std::forward<Range>(a_range))
+        );
+    }
+
+    template <std::ranges::viewable_range Range>
+    requires byte_input_range<Range>
+    friend auto operator|(
+        Range&& a_range,
+        transcode_adaptor const& a_adaptor
+    )
+    {
+        return a_adaptor(std::forward<Range>(a_range));
+    }
+};
+
+}   // namespace detail
+
+/**
+ * @brief Range adaptors that encode or decode lazily, with the default options of the matching
+ * one-shot functions. The decoders are strict - their output ends right before the first invalid
+ * character, and `error()` of the view tells it apart from the end of the input.
+ */
+namespace views
+{
+
+inline constexpr detail::transcode_adaptor<detail::encode_policy<base16_encoder>> base16_encode {};
+inline constexpr detail::transcode_adaptor<detail::decode_policy<base16_decoder>> base16_decode {};
+inline constexpr detail::transcode_adaptor<detail::encode_policy<base32_encoder>> base32_encode {};
+inline constexpr detail::transcode_adaptor<detail::decode_policy<base32_decoder>> base32_decode {};
+inline constexpr detail::transcode_adaptor<detail::encode_policy<base32hex_encoder>>
+    base32hex_encode {};
+inline constexpr detail::transcode_adaptor<detail::decode_policy<base32hex_decoder>>
+    base32hex_decode {};
+inline constexpr detail::transcode_adaptor<detail::encode_policy<base64_encoder>> base64_encode {};
+inline constexpr detail::transcode_adaptor<detail::decode_policy<base64_decoder>> base64_decode {};
+inline constexpr detail::transcode_adaptor<detail::encode_policy<base64url_encoder>>
+    base64url_encode {};
+inline constexpr detail::transcode_adaptor<detail::decode_policy<base64url_decoder>>
+    base64url_decode {};
+
+/**
+ * @brief Shorthands for the Base16 views.
+ */
+inline constexpr auto hex = base16_encode;
+inline constexpr auto unhex = base16_decode;
+
+}   // namespace views
+}   // namespace base_codec
+}   // namespace rs
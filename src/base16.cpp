@@ -1,9 +1,11 @@
 #include <base_codec/base16.hpp>
 
-#include <sstream>
-#include <cassert>
-#include <stdexcept>
-#include <unordered_map>
+#include "swar.hpp"
+#include "codec.hpp"
+#include "inplace.hpp"
+#include "kernels.hpp"
+
+#include <cstring>
 
 
 namespace rs
@@ -11,105 +13,320 @@ namespace rs
 namespace base_codec
 {
 
-static std::vector<char> const base16_encode_alphabet = {
-'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'
-};
+static constexpr auto base16_encode_pairs = detail::make_pair_table<4>(base16_alphabet::symbols);
 
-static std::unordered_map<char, uint8_t> const base16_decode_alpahbet = {
-    {'0', 0}, {'1', 1}, {'2', 2}, {'3', 3}, {'4', 4}, {'5', 5}, {'6', 6}, {'7', 7}, {'8', 8},
-    {'9', 9}, {'A', 10}, {'B', 11}, {'C', 12}, {'D', 13}, {'E', 14}, {'F', 15}
-};
+static constexpr auto const& base16_decode_values = detail::decode_table<base16_alphabet>;
 
-auto base16_encode(
-    std::vector<std::uint8_t> const& a_data,
-    std::error_code& a_ec
+auto detail::base16_encode_scalar(
+    std::uint8_t const* a_in,
+    std::size_t a_size,
+    char* a_out
 )
--> std::string
+-> std::size_t
+{
+    std::size_t consumed = 0;
+
+    // NOTE - Four bytes per step: one pair lookup per byte and one 8 byte store.
+    for (; consumed + 4 <= a_size; consumed += 4, a_out += 8)
+    {
+        detail::store_pairs(
+            a_out,
+            base16_encode_pairs.data(),
+            a_in[consumed],
+            a_in[consumed + 1],
+            a_in[consumed + 2],
+            a_in[consumed + 3]
+        );
+    }
+
+    for (; consumed < a_size; ++consumed, a_out += 2)
+    {
+        std::memcpy(a_out, base16_encode_pairs.data() + a_in[consumed] * 2, 2);
+    }
+
+    return consumed;
+}
+
+auto detail::base16_decode_scalar(
+    char const* a_in,
+    std::size_t a_size,
+    std::uint8_t* a_out
+)
+-> std::size_t
 {
-    std::ostringstream s;
+    auto const* symbols = reinterpret_cast<unsigned char const*>(a_in);
+    std::size_t consumed = 0;
 
-    for (auto const datum : a_data)
+    // NOTE - Four bytes per step. Invalid characters map to 0xFF, so they only get looked for
+    //        once per step, in the OR of all the values.
+    for (; consumed + 8 <= a_size; consumed += 8, a_out += 4)
     {
-        std::uint8_t first_idx = datum >> 4;
-        std::uint8_t second_idx = datum & 0b00001111;
+        std::uint32_t bit_buffer = 0;
+        std::uint32_t errors = 0;
 
-        try
+        for (std::size_t i = 0; i < 8; ++i)
         {
-            s << base16_encode_alphabet.at(first_idx)
-              << base16_encode_alphabet.at(second_idx);
-        } catch (std::out_of_range const& e)
+            auto const value = base16_decode_values[symbols[consumed + i]];
+            errors |= value;
+            bit_buffer = (bit_buffer << 4) | value;
+        }
+
+        if (errors & 0xF0)
+        {
+            break;
+        }
+
+        detail::store_be<4>(a_out, bit_buffer);
+    }
+
+    // NOTE - The last few pairs, or the valid part of a step that had an invalid character in it.
+    for (; consumed + 2 <= a_size; consumed += 2, ++a_out)
+    {
+        auto const hi = base16_decode_values[symbols[consumed]];
+        auto const lo = base16_decode_values[symbols[consumed + 1]];
+
+        if ((hi | lo) & 0xF0)
         {
-            a_ec = std::make_error_code(std::errc::result_out_of_range);
-            assert(false && "you really shouldn't be here");
-            return {};
+            break;
         }
+
+        *a_out = static_cast<std::uint8_t>((hi << 4) | lo);
     }
 
-    return s.str();
+    return consumed;
 }
 
-auto base16_decode(
+auto detail::base16_validate_scalar(
+    char const* a_in,
+    std::size_t a_size
+)
+-> std::size_t
+{
+    return detail::valid_prefix(a_in, a_size, base16_decode_values);
+}
+
+auto base16_encode_into(
+    std::span<std::uint8_t const> a_data,
+    std::span<char> a_out,
+    std::error_code& a_ec
+)
+-> std::size_t
+{
+    if (a_out.size() < base16_encoded_size(a_data.size()))
+    {
+        a_ec = std::make_error_code(std::errc::no_buffer_space);
+        return 0;
+    }
+
+    detail::active_kernels().base16_encode(a_data.data(), a_data.size(), a_out.data());
+    return base16_encoded_size(a_data.size());
+}
+
+auto base16_encode_inplace(
+    std::span<char> a_buffer,
+    std::size_t a_size,
+    std::error_code& a_ec
+)
+-> std::size_t
+{
+    if (a_size > a_buffer.size() || a_buffer.size() < base16_encoded_size(a_size))
+    {
+        a_ec = std::make_error_code(std::errc::no_buffer_space);
+        return 0;
+    }
+
+    auto const kernel = detail::active_kernels().base16_encode;
+
+    return detail::encode_backwards<1, 2>(
+        a_buffer.data(),
+        a_size,
+        [&](std::uint8_t const* a_in, std::size_t a_in_size, char* a_out)
+        {
+            kernel(a_in, a_in_size, a_out);
+            return base16_encoded_size(a_in_size);
+        }
+    );
+}
+
+auto base16_encode(
+    std::vector<std::uint8_t> const& a_data,
+    std::error_code& a_ec
+)
+-> std::string
+{
+    std::string ret(base16_encoded_size(a_data.size()), '\0');
+    base16_encode_into(a_data, ret, a_ec);
+    return ret;
+}
+
+auto base16_decode_into(
     std::string_view const& a_data,
+    std::span<std::uint8_t> a_out,
     std::error_code& a_ec,
     bool a_strict
 )
--> std::vector<std::uint8_t>
+-> std::size_t
 {
     if (a_strict && a_data.size() % 2 != 0)
     {
         a_ec = std::make_error_code(std::errc::invalid_argument);
-        return {};
+        return 0;
+    }
+
+    if (a_out.size() < base16_decoded_size(a_data))
+    {
+        a_ec = std::make_error_code(std::errc::no_buffer_space);
+        return 0;
+    }
+
+    detail::decoder_state state;
+    return detail::codec_decode<base16_alphabet>(
+        a_data,
+        a_out.data(),
+        a_ec,
+        a_strict,
+        '\0',
+        detail::active_kernels().base16_decode,
+        state
+    );
+}
+
+auto base16_decode_inplace(
+    std::span<char> a_buffer,
+    std::error_code& a_ec,
+    bool a_strict
+)
+-> std::size_t
+{
+    if (a_strict && a_buffer.size() % 2 != 0)
+    {
+        a_ec = std::make_error_code(std::errc::invalid_argument);
+        return 0;
     }
 
-    std::vector<std::uint8_t> ret;
-    ret.reserve(a_data.size() / 2);
+    // NOTE - The decoder never writes past the characters it has already read, so it can
+    //        overwrite its own input as it goes.
+    detail::decoder_state state;
+    return detail::codec_decode<base16_alphabet>(
+        std::string_view(a_buffer.data(), a_buffer.size()),
+        reinterpret_cast<std::uint8_t*>(a_buffer.data()),
+        a_ec,
+        a_strict,
+        '\0',
+        detail::active_kernels().base16_decode,
+        state
+    );
+}
+
+auto base16_decode(
+    std::string_view const& a_data,
+    std::error_code& a_ec,
+    bool a_strict
+)
+-> std::vector<std::uint8_t>
+{
+    std::vector<std::uint8_t> ret(base16_decoded_size(a_data));
+    ret.resize(base16_decode_into(a_data, ret, a_ec, a_strict));
+    return ret;
+}
+
+auto base16_encoder::max_update_size(std::size_t a_size) const -> std::size_t
+{
+    return a_size * 2;
+}
+
+auto base16_encoder::update(
+    std::span<std::uint8_t const> a_data,
+    std::span<char> a_out,
+    std::error_code& a_ec
+)
+-> std::size_t
+{
+    return base16_encode_into(a_data, a_out, a_ec);
+}
+
+auto base16_encoder::finish(
+    std::span<char> /* a_out */,
+    std::error_code& /* a_ec */
+)
+-> std::size_t
+{
+    return 0;
+}
+
+base16_decoder::base16_decoder(bool a_strict)
+    : m_strict(a_strict)
+{
+}
 
-    bool is_even = true;
-    std::uint8_t decoded = 0;
+auto base16_decoder::max_update_size(std::size_t a_size) const -> std::size_t
+{
+    return (m_state.num_bits + a_size * 4) / 8;
+}
 
-    for (auto const datum : a_data)
+auto base16_decoder::update(
+    std::string_view const& a_data,
+    std::span<std::uint8_t> a_out,
+    std::error_code& a_ec
+)
+-> std::size_t
+{
+    if (a_out.size() < max_update_size(a_data.size()))
     {
-        try
-        {
-            if (is_even)
-            {
-                decoded |= base16_decode_alpahbet.at(datum) << 4;
-            } else
-            {
-                decoded |= base16_decode_alpahbet.at(datum);
-                ret.push_back(decoded);
-                decoded = 0;
-            }
-
-            is_even = !is_even;
-        } catch (std::out_of_range const& e)
-        {
-            if (a_strict)
-            {
-                a_ec = std::make_error_code(std::errc::invalid_argument);
-                return {};
-            }
+        a_ec = std::make_error_code(std::errc::no_buffer_space);
+        return 0;
+    }
 
-            continue;
-        }
+    return detail::codec_decode<base16_alphabet>(
+        a_data,
+        a_out.data(),
+        a_ec,
+        m_strict,
+        '\0',
+        detail::active_kernels().base16_decode,
+        m_state
+    );
+}
+
+auto base16_decoder::finish(std::error_code& a_ec) -> void
+{
+    if (m_strict && m_state.num_bits != 0)
+    {
+        a_ec = std::make_error_code(std::errc::invalid_argument);
     }
 
-    return ret;
+    m_state = {};
 }
 
-auto is_base16(std::string_view const& a_data) -> bool
+auto is_base16(
+    std::string_view const& a_data,
+    validation_error& a_error
+)
+-> bool
 {
-    for (auto const datum : a_data)
+    auto const valid = detail::active_kernels().base16_validate(a_data.data(), a_data.size());
+
+    if (valid != a_data.size())
     {
-        if (!base16_decode_alpahbet.contains(datum))
-        {
-            return false;
-        }
+        a_error = {valid, a_data[valid]};
+        return false;
+    }
+
+    if (a_data.size() % 2 != 0)
+    {
+        a_error = {a_data.size(), '\0'};
+        return false;
     }
 
     return true;
 }
 
+auto is_base16(std::string_view const& a_data) -> bool
+{
+    validation_error error;
+    return is_base16(a_data, error);
+}
+
 }   // namespace base_codec
 }   // namespace rs
 
@@ -0,0 +1,195 @@
+#include "interleave.hpp"
+#include "kernels.hpp"
+
+#include <array>
+#include <bit>
+
+#include <immintrin.h>
+
+
+namespace rs
+{
+namespace base_codec
+{
+
+auto detail::base16_encode_avx2(
+    std::uint8_t const* a_in,
+    std::size_t a_size,
+    char* a_out
+)
+-> std::size_t
+{
+    auto const alphabet = _mm256_setr_epi8(
+        '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F',
+        '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'
+    );
+    auto const nibble_mask = _mm256_set1_epi8(0x0F);
+
+    std::size_t consumed = 0;
+
+    for (; consumed + 32 <= a_size; consumed += 32, a_out += 64)
+    {
+        auto const in = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(a_in + consumed));
+        auto const hi = _mm256_shuffle_epi8(
+            alphabet,
+            _mm256_and_si256(_mm256_srli_epi16(in, 4), nibble_mask)
+        );
+        auto const lo = _mm256_shuffle_epi8(alphabet, _mm256_and_si256(in, nibble_mask));
+
+        // NOTE - The unpacks work per 128-bit lane, so the halves get put back in order.
+        auto const first = _mm256_unpacklo_epi8(hi, lo);
+        auto const second = _mm256_unpackhi_epi8(hi, lo);
+
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(a_out),
+            _mm256_permute2x128_si256(first, second, 0x20)
+        );
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(a_out + 32),
+            _mm256_permute2x128_si256(first, second, 0x31)
+        );
+    }
+
+    return consumed + base16_encode_sse41(a_in + consumed, a_size - consumed, a_out);
+}
+
+auto detail::base16_encode_items_avx2(
+    std::uint8_t const* a_in,
+    std::size_t a_item_size,
+    std::size_t a_items,
+    char* a_out,
+    std::size_t a_stride
+)
+-> std::size_t
+{
+    auto const alphabet = _mm256_setr_epi8(
+        '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F',
+        '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'
+    );
+    auto const nibble_mask = _mm256_set1_epi8(0x0F);
+
+    // NOTE - Every lane holds a byte of a different item, so every column of bytes makes two
+    //        columns of digits without any shuffling across lanes.
+    return encode_items_interleaved_avx2<8, 4>(
+        a_in,
+        a_item_size,
+        a_items,
+        a_out,
+        a_stride,
+        [&](interleaved_block const& a_bytes, interleaved_block& a_digits)
+        {
+            for (std::size_t i = 0; i < 8; ++i)
+            {
+                a_digits[2 * i] = _mm256_shuffle_epi8(
+                    alphabet,
+                    _mm256_and_si256(_mm256_srli_epi16(a_bytes[i], 4), nibble_mask)
+                );
+                a_digits[2 * i + 1] = _mm256_shuffle_epi8(
+                    alphabet,
+                    _mm256_and_si256(a_bytes[i], nibble_mask)
+                );
+            }
+        }
+    );
+}
+
+/**
+ * Maps 32 hex characters (either case) to their nibble values and reports which of them are
+ * valid in the returned mask.
+ */
+static inline auto base16_decode_avx2_nibbles(__m256i a_in, std::uint32_t& a_valid) -> __m256i
+{
+    // NOTE - Setting bit 5 folds 'A'-'F' onto 'a'-'f' and nothing else onto that range, while
+    //        the digit range is checked on the untouched input.
+    auto const folded = _mm256_or_si256(a_in, _mm256_set1_epi8(0x20));
+    auto const is_digit = _mm256_and_si256(
+        _mm256_cmpgt_epi8(a_in, _mm256_set1_epi8('0' - 1)),
+        _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), a_in)
+    );
+    auto const is_letter = _mm256_and_si256(
+        _mm256_cmpgt_epi8(folded, _mm256_set1_epi8('a' - 1)),
+        _mm256_cmpgt_epi8(_mm256_set1_epi8('f' + 1), folded)
+    );
+
+    a_valid = static_cast<std::uint32_t>(
+        _mm256_movemask_epi8(_mm256_or_si256(is_digit, is_letter))
+    );
+
+    return _mm256_blendv_epi8(
+        _mm256_sub_epi8(folded, _mm256_set1_epi8('a' - 10)),
+        _mm256_sub_epi8(a_in, _mm256_set1_epi8('0')),
+        is_digit
+    );
+}
+
+auto detail::base16_decode_avx2(
+    char const* a_in,
+    std::size_t a_size,
+    std::uint8_t* a_out
+)
+-> std::size_t
+{
+    auto const weights = _mm256_set1_epi16(0x0110);
+
+    std::size_t consumed = 0;
+
+    for (; consumed + 64 <= a_size; consumed += 64, a_out += 32)
+    {
+        std::uint32_t valid_first = 0;
+        std::uint32_t valid_second = 0;
+        auto const first = base16_decode_avx2_nibbles(
+            _mm256_loadu_si256(reinterpret_cast<__m256i const*>(a_in + consumed)),
+            valid_first
+        );
+        auto const second = base16_decode_avx2_nibbles(
+            _mm256_loadu_si256(reinterpret_cast<__m256i const*>(a_in + consumed + 32)),
+            valid_second
+        );
+
+        if ((valid_first & valid_second) != 0xFFFFFFFF)
+        {
+            break;
+        }
+
+        // NOTE - (hi * 16 + lo) per character pair, narrowed back to bytes and with the lanes
+        //        put back in order.
+        auto const bytes = _mm256_packus_epi16(
+            _mm256_maddubs_epi16(first, weights),
+            _mm256_maddubs_epi16(second, weights)
+        );
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(a_out),
+            _mm256_permute4x64_epi64(bytes, 0b11011000)
+        );
+    }
+
+    return consumed + base16_decode_sse41(a_in + consumed, a_size - consumed, a_out);
+}
+
+auto detail::base16_validate_avx2(
+    char const* a_in,
+    std::size_t a_size
+)
+-> std::size_t
+{
+    std::size_t consumed = 0;
+
+    for (; consumed + 32 <= a_size; consumed += 32)
+    {
+        std::uint32_t valid = 0;
+        base16_decode_avx2_nibbles(
+            _mm256_loadu_si256(reinterpret_cast<__m256i const*>(a_in + consumed)),
+            valid
+        );
+
+        if (valid != 0xFFFFFFFF)
+        {
+            return consumed + static_cast<std::size_t>(std::countr_one(valid));
+        }
+    }
+
+    return consumed + base16_validate_sse41(a_in + consumed, a_size - consumed);
+}
+
+}   // namespace base_codec
+}   // namespace rs
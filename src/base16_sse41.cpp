@@ -0,0 +1,135 @@
+#include "kernels.hpp"
+
+#include <bit>
+
+#include <immintrin.h>
+
+
+namespace rs
+{
+namespace base_codec
+{
+
+auto detail::base16_encode_sse41(
+    std::uint8_t const* a_in,
+    std::size_t a_size,
+    char* a_out
+)
+-> std::size_t
+{
+    auto const alphabet = _mm_setr_epi8(
+        '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'
+    );
+    auto const nibble_mask = _mm_set1_epi8(0x0F);
+
+    std::size_t consumed = 0;
+
+    for (; consumed + 16 <= a_size; consumed += 16, a_out += 32)
+    {
+        auto const in = _mm_loadu_si128(reinterpret_cast<__m128i const*>(a_in + consumed));
+        auto const hi = _mm_shuffle_epi8(alphabet, _mm_and_si128(_mm_srli_epi16(in, 4), nibble_mask));
+        auto const lo = _mm_shuffle_epi8(alphabet, _mm_and_si128(in, nibble_mask));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(a_out), _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(a_out + 16), _mm_unpackhi_epi8(hi, lo));
+    }
+
+    return consumed + base16_encode_scalar(a_in + consumed, a_size - consumed, a_out);
+}
+
+/**
+ * Maps 16 hex characters (either case) to their nibble values and reports which of them are
+ * valid in the returned mask.
+ */
+static inline auto base16_decode_sse41_nibbles(__m128i a_in, int& a_valid) -> __m128i
+{
+    // NOTE - Setting bit 5 folds 'A'-'F' onto 'a'-'f' and nothing else onto that range, while
+    //        the digit range is checked on the untouched input.
+    auto const folded = _mm_or_si128(a_in, _mm_set1_epi8(0x20));
+    auto const is_digit = _mm_and_si128(
+        _mm_cmpgt_epi8(a_in, _mm_set1_epi8('0' - 1)),
+        _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), a_in)
+    );
+    auto const is_letter = _mm_and_si128(
+        _mm_cmpgt_epi8(folded, _mm_set1_epi8('a' - 1)),
+        _mm_cmpgt_epi8(_mm_set1_epi8('f' + 1), folded)
+    );
+
+    a_valid = _mm_movemask_epi8(_mm_or_si128(is_digit, is_letter));
+
+    return _mm_blendv_epi8(
+        _mm_sub_epi8(folded, _mm_set1_epi8('a' - 10)),
+        _mm_sub_epi8(a_in, _mm_set1_epi8('0')),
+        is_digit
+    );
+}
+
+auto detail::base16_decode_sse41(
+    char const* a_in,
+    std::size_t a_size,
+    std::uint8_t* a_out
+)
+-> std::size_t
+{
+    auto const weights = _mm_set1_epi16(0x0110);
+
+    std::size_t consumed = 0;
+
+    for (; consumed + 32 <= a_size; consumed += 32, a_out += 16)
+    {
+        int valid_first = 0;
+        int valid_second = 0;
+        auto const first = base16_decode_sse41_nibbles(
+            _mm_loadu_si128(reinterpret_cast<__m128i const*>(a_in + consumed)),
+            valid_first
+        );
+        auto const second = base16_decode_sse41_nibbles(
+            _mm_loadu_si128(reinterpret_cast<__m128i const*>(a_in + consumed + 16)),
+            valid_second
+        );
+
+        if ((valid_first & valid_second) != 0xFFFF)
+        {
+            break;
+        }
+
+        // NOTE - (hi * 16 + lo) per character pair, then narrowed back to bytes.
+        auto const bytes = _mm_packus_epi16(
+            _mm_maddubs_epi16(first, weights),
+            _mm_maddubs_epi16(second, weights)
+        );
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(a_out), bytes);
+    }
+
+    return consumed + base16_decode_scalar(a_in + consumed, a_size - consumed, a_out);
+}
+
+auto detail::base16_validate_sse41(
+    char const* a_in,
+    std::size_t a_size
+)
+-> std::size_t
+{
+    std::size_t consumed = 0;
+
+    for (; consumed + 16 <= a_size; consumed += 16)
+    {
+        int valid = 0;
+        base16_decode_sse41_nibbles(
+            _mm_loadu_si128(reinterpret_cast<__m128i const*>(a_in + consumed)),
+            valid
+        );
+
+        if (valid != 0xFFFF)
+        {
+            return consumed + static_cast<std::size_t>(
+                std::countr_one(static_cast<unsigned>(valid))
+            );
+        }
+    }
+
+    return consumed + base16_validate_scalar(a_in + consumed, a_size - consumed);
+}
+
+}   // namespace base_codec
+}   // namespace rs
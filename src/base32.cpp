@@ -1,10 +1,12 @@
 #include <base_codec/base32.hpp>
 
-#include <bitset>
-#include <sstream>
-#include <cassert>
-#include <stdexcept>
-#include <unordered_map>
+#include "swar.hpp"
+#include "codec.hpp"
+#include "inplace.hpp"
+#include "kernels.hpp"
+#include "streaming.hpp"
+
+#include <array>
 
 
 namespace rs
@@ -12,114 +14,196 @@ namespace rs
 namespace base_codec
 {
 
-static std::vector<char> const base32_encode_alphabet = {
-    'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S',
-    'T', 'U', 'V', 'W', 'X', 'Y', 'Z', '2', '3', '4', '5', '6', '7'
-};
+static constexpr auto base32_encode_pairs = detail::make_pair_table<5>(base32_alphabet::symbols);
 
-static std::vector<char> const base32hex_encode_alphabet = {
-    '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I',
-    'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z'
-};
+static constexpr auto base32hex_encode_pairs = detail::make_pair_table<5>(
+    base32hex_alphabet::symbols
+);
 
-static std::unordered_map<char, uint8_t> const base32_decode_alpahbet = {
-    {'A', 0},  {'B', 1},  {'C', 2},  {'D', 3},  {'E', 4},  {'F', 5},  {'G', 6},  {'H', 7}, {'I', 8},
-    {'J', 9},  {'K', 10}, {'L', 11}, {'M', 12}, {'N', 13}, {'O', 14}, {'P', 15}, {'Q', 16},
-    {'R', 17}, {'S', 18}, {'T', 19}, {'U', 20}, {'V', 21}, {'W', 22}, {'X', 23}, {'Y', 24},
-    {'Z', 25}, {'2', 26}, {'3', 27}, {'4', 28}, {'5', 29}, {'6', 30}, {'7', 31}
-};
+static constexpr auto const& base32_decode_values = detail::decode_table<base32_alphabet>;
 
-static std::unordered_map<char, uint8_t> const base32hex_decode_alpahbet = {
-    {'0', 0},  {'1', 1},  {'2', 2},  {'3', 3},  {'4', 4},  {'5', 5},  {'6', 6},  {'7', 7}, {'8', 8},
-    {'9', 9},  {'A', 10}, {'B', 11}, {'C', 12}, {'D', 13}, {'E', 14}, {'F', 15}, {'G', 16},
-    {'H', 17}, {'I', 18}, {'J', 19}, {'K', 20}, {'L', 21}, {'M', 22}, {'N', 23}, {'O', 24},
-    {'P', 25}, {'Q', 26}, {'R', 27}, {'S', 28}, {'T', 29}, {'U', 30}, {'V', 31}
-};
+static constexpr auto const& base32hex_decode_values = detail::decode_table<base32hex_alphabet>;
 
-static auto base32_encode_algo(
-    std::vector<std::uint8_t> const& a_data,
-    std::error_code& a_ec,
-    bool a_padding,
-    char a_pad_character,
-    std::vector<char> const& a_encode_alphabet
+static auto base32_encode_blocks(
+    std::uint8_t const* a_in,
+    std::size_t a_size,
+    char* a_out,
+    std::array<char, 2048> const& a_encode_pairs
 )
--> std::string
+-> std::size_t
 {
-    std::ostringstream s;
+    std::size_t const blocks = a_size / 5;
+
+    // NOTE - One block per step: 40 bits, four 10-bit pair lookups and one 8 byte store.
+    for (std::size_t i = 0; i < blocks; ++i, a_in += 5, a_out += 8)
+    {
+        auto const bit_buffer = detail::load_be<5>(a_in);
+
+        detail::store_pairs(
+            a_out,
+            a_encode_pairs.data(),
+            bit_buffer >> 30,
+            (bit_buffer >> 20) & 0x3FF,
+            (bit_buffer >> 10) & 0x3FF,
+            bit_buffer & 0x3FF
+        );
+    }
 
-    static std::bitset<40> const mask {0x1F};
-    std::uint64_t num_bits = 0;
-    std::bitset<40> bit_buffer {0};
+    return blocks * 5;
+}
 
-    for (auto const datum : a_data)
+static auto base32_decode_blocks(
+    char const* a_in,
+    std::size_t a_size,
+    std::uint8_t* a_out,
+    std::array<std::uint8_t, 256> const& a_decode_values
+)
+-> std::size_t
+{
+    auto const* symbols = reinterpret_cast<unsigned char const*>(a_in);
+    std::size_t consumed = 0;
+
+    // NOTE - Invalid characters map to 0xFF, so they only get looked for once per block, in the
+    //        OR of all the values.
+    for (; consumed + 8 <= a_size; consumed += 8, a_out += 5)
     {
-        bit_buffer <<= 8;
-        bit_buffer |= datum;
-        num_bits += 8;
+        std::uint64_t bit_buffer = 0;
+        std::uint32_t errors = 0;
 
-        while (num_bits >= 5)
+        for (std::size_t i = 0; i < 8; ++i)
         {
-            auto mask_at_pos = mask << (num_bits - 5);
-            auto idx = bit_buffer & mask_at_pos;
-            idx >>= num_bits - 5;
-            // bit_buffer &= ~mask_at_pos;
-            num_bits -= 5;
-            try
-            {
-                s << a_encode_alphabet.at(idx.to_ulong());
-            } catch (std::out_of_range const& e)
-            {
-                a_ec = std::make_error_code(std::errc::result_out_of_range);
-                assert(false && "you shouldn't be here");
-                return {};
-            }
+            auto const value = a_decode_values[symbols[consumed + i]];
+            errors |= value;
+            bit_buffer = (bit_buffer << 5) | value;
         }
-    }
 
-    // NOTE - At the end of this we might have a few bytes left (less than five) in the buffer,
-    //        so we process them too.
-    if (num_bits > 0)
-    {
-        try
-        {
-            // NOTE - We need to pad the bits on the right with 0 to make it 5 bits.
-            bit_buffer <<= 5 - num_bits;
-            s << a_encode_alphabet.at((bit_buffer & mask).to_ulong());
-        } catch (std::out_of_range const& e)
+        if (errors & 0xE0)
         {
-            a_ec = std::make_error_code(std::errc::result_out_of_range);
-            assert(false && "you shouldn't be here");
-            return {};
+            break;
         }
+
+        detail::store_be<5>(a_out, bit_buffer);
     }
 
-    if (a_padding)
+    return consumed;
+}
+
+auto detail::base32_encode_scalar(
+    std::uint8_t const* a_in,
+    std::size_t a_size,
+    char* a_out
+)
+-> std::size_t
+{
+    return base32_encode_blocks(a_in, a_size, a_out, base32_encode_pairs);
+}
+
+auto detail::base32hex_encode_scalar(
+    std::uint8_t const* a_in,
+    std::size_t a_size,
+    char* a_out
+)
+-> std::size_t
+{
+    return base32_encode_blocks(a_in, a_size, a_out, base32hex_encode_pairs);
+}
+
+auto detail::base32_decode_scalar(
+    char const* a_in,
+    std::size_t a_size,
+    std::uint8_t* a_out
+)
+-> std::size_t
+{
+    return base32_decode_blocks(a_in, a_size, a_out, base32_decode_values);
+}
+
+auto detail::base32hex_decode_scalar(
+    char const* a_in,
+    std::size_t a_size,
+    std::uint8_t* a_out
+)
+-> std::size_t
+{
+    return base32_decode_blocks(a_in, a_size, a_out, base32hex_decode_values);
+}
+
+auto detail::base32_validate_scalar(
+    char const* a_in,
+    std::size_t a_size
+)
+-> std::size_t
+{
+    return detail::valid_prefix(a_in, a_size, base32_decode_values);
+}
+
+auto detail::base32hex_validate_scalar(
+    char const* a_in,
+    std::size_t a_size
+)
+-> std::size_t
+{
+    return detail::valid_prefix(a_in, a_size, base32hex_decode_values);
+}
+
+auto base32_encode_into(
+    std::span<std::uint8_t const> a_data,
+    std::span<char> a_out,
+    std::error_code& a_ec,
+    bool a_padding,
+    char a_pad_character
+)
+-> std::size_t
+{
+    if (a_out.size() < base32_encoded_size(a_data.size(), a_padding))
     {
-        switch (a_data.size() % 5)
-        {
-        case 4:
-            s << std::string(1, a_pad_character);
-            break;
-        case 3:
-            s << std::string(3, a_pad_character);
-            break;
-        case 2:
-            s << std::string(4, a_pad_character);
-            break;
-        case 1:
-            s << std::string(6, a_pad_character);
-            break;
-        case 0:
-            break;
-        default:
-            assert(false && "you really shoudn't be here");
-            break;
-        }
+        a_ec = std::make_error_code(std::errc::no_buffer_space);
+        return 0;
     }
 
-    return s.str();
+    return detail::codec_encode<base32_alphabet>(
+        a_data.data(),
+        a_data.size(),
+        a_out.data(),
+        a_padding,
+        a_pad_character,
+        detail::active_kernels().base32_encode
+    );
 }
 
+auto base32_encode_inplace(
+    std::span<char> a_buffer,
+    std::size_t a_size,
+    std::error_code& a_ec,
+    bool a_padding,
+    char a_pad_character
+)
+-> std::size_t
+{
+    if (a_size > a_buffer.size() || a_buffer.size() < base32_encoded_size(a_size, a_padding))
+    {
+        a_ec = std::make_error_code(std::errc::no_buffer_space);
+        return 0;
+    }
+
+    auto const kernel = detail::active_kernels().base32_encode;
+
+    return detail::encode_backwards<5, 8>(
+        a_buffer.data(),
+        a_size,
+        [&](std::uint8_t const* a_in, std::size_t a_in_size, char* a_out)
+        {
+            return detail::codec_encode<base32_alphabet>(
+                a_in,
+                a_in_size,
+                a_out,
+                a_padding,
+                a_pad_character,
+                kernel
+            );
+        }
+    );
+}
 
 auto base32_encode(
     std::vector<std::uint8_t> const& a_data,
@@ -129,12 +213,67 @@ auto base32_encode(
 )
 -> std::string
 {
-    return base32_encode_algo(
-        a_data,
-        a_ec,
+    std::string ret(base32_encoded_size(a_data.size(), a_padding), '\0');
+    base32_encode_into(a_data, ret, a_ec, a_padding, a_pad_character);
+    return ret;
+}
+
+auto base32hex_encode_into(
+    std::span<std::uint8_t const> a_data,
+    std::span<char> a_out,
+    std::error_code& a_ec,
+    bool a_padding,
+    char a_pad_character
+)
+-> std::size_t
+{
+    if (a_out.size() < base32_encoded_size(a_data.size(), a_padding))
+    {
+        a_ec = std::make_error_code(std::errc::no_buffer_space);
+        return 0;
+    }
+
+    return detail::codec_encode<base32hex_alphabet>(
+        a_data.data(),
+        a_data.size(),
+        a_out.data(),
         a_padding,
         a_pad_character,
-        base32_encode_alphabet
+        detail::active_kernels().base32hex_encode
+    );
+}
+
+auto base32hex_encode_inplace(
+    std::span<char> a_buffer,
+    std::size_t a_size,
+    std::error_code& a_ec,
+    bool a_padding,
+    char a_pad_character
+)
+-> std::size_t
+{
+    if (a_size > a_buffer.size() || a_buffer.size() < base32_encoded_size(a_size, a_padding))
+    {
+        a_ec = std::make_error_code(std::errc::no_buffer_space);
+        return 0;
+    }
+
+    auto const kernel = detail::active_kernels().base32hex_encode;
+
+    return detail::encode_backwards<5, 8>(
+        a_buffer.data(),
+        a_size,
+        [&](std::uint8_t const* a_in, std::size_t a_in_size, char* a_out)
+        {
+            return detail::codec_encode<base32hex_alphabet>(
+                a_in,
+                a_in_size,
+                a_out,
+                a_padding,
+                a_pad_character,
+                kernel
+            );
+        }
     );
 }
 
@@ -146,82 +285,119 @@ auto base32hex_encode(
 )
 -> std::string
 {
-    return base32_encode_algo(
+    std::string ret(base32_encoded_size(a_data.size(), a_padding), '\0');
+    base32hex_encode_into(a_data, ret, a_ec, a_padding, a_pad_character);
+    return ret;
+}
+
+auto base32_decode_into(
+    std::string_view const& a_data,
+    std::span<std::uint8_t> a_out,
+    std::error_code& a_ec,
+    bool a_strict,
+    char a_pad_character
+)
+-> std::size_t
+{
+    if (a_out.size() < base32_decoded_size(a_data, a_pad_character))
+    {
+        a_ec = std::make_error_code(std::errc::no_buffer_space);
+        return 0;
+    }
+
+    detail::decoder_state state;
+    return detail::codec_decode<base32_alphabet>(
         a_data,
+        a_out.data(),
         a_ec,
-        a_padding,
+        a_strict,
+        a_pad_character,
+        detail::active_kernels().base32_decode,
+        state
+    );
+}
+
+auto base32_decode_inplace(
+    std::span<char> a_buffer,
+    std::error_code& a_ec,
+    bool a_strict,
+    char a_pad_character
+)
+-> std::size_t
+{
+    // NOTE - The decoder never writes past the characters it has already read, so it can
+    //        overwrite its own input as it goes.
+    detail::decoder_state state;
+    return detail::codec_decode<base32_alphabet>(
+        std::string_view(a_buffer.data(), a_buffer.size()),
+        reinterpret_cast<std::uint8_t*>(a_buffer.data()),
+        a_ec,
+        a_strict,
         a_pad_character,
-        base32hex_encode_alphabet
+        detail::active_kernels().base32_decode,
+        state
     );
 }
 
-static auto base32_decode_algo(
+auto base32_decode(
     std::string_view const& a_data,
     std::error_code& a_ec,
     bool a_strict,
-    char a_pad_character,
-    std::unordered_map<char, uint8_t> const& a_decode_alphabet
+    char a_pad_character
 )
 -> std::vector<std::uint8_t>
 {
-    std::vector<std::uint8_t> ret;
-
-    static std::bitset<40> const mask {0xFF};
-    std::uint64_t num_bits = 0;
-    std::bitset<40> bit_buffer;
+    std::vector<std::uint8_t> ret(base32_decoded_size(a_data, a_pad_character));
+    ret.resize(base32_decode_into(a_data, ret, a_ec, a_strict, a_pad_character));
+    return ret;
+}
 
-    for (auto const datum : a_data)
+auto base32hex_decode_into(
+    std::string_view const& a_data,
+    std::span<std::uint8_t> a_out,
+    std::error_code& a_ec,
+    bool a_strict,
+    char a_pad_character
+)
+-> std::size_t
+{
+    if (a_out.size() < base32_decoded_size(a_data, a_pad_character))
     {
-        if (datum == a_pad_character)
-        {
-            break;
-        }
-
-        try
-        {
-            std::uint8_t value = a_decode_alphabet.at(datum);
-            bit_buffer <<= 5;
-            bit_buffer |= value;
-            num_bits += 5;
-
-            while (num_bits >= 8)
-            {
-                auto mask_at_pos = mask << (num_bits - 8);
-                auto value = bit_buffer & mask_at_pos;
-                value >>= num_bits - 8;
-                ret.push_back(static_cast<std::uint8_t>(value.to_ulong()));
-                // bit_buffer &= ~mask_at_pos;
-                num_bits -= 8;
-            }
-        } catch (std::out_of_range const& e)
-        {
-            if (a_strict)
-            {
-                a_ec = std::make_error_code(std::errc::invalid_argument);
-                return {};
-            }
-
-            continue;
-        }
+        a_ec = std::make_error_code(std::errc::no_buffer_space);
+        return 0;
     }
 
-    return ret;
+    detail::decoder_state state;
+    return detail::codec_decode<base32hex_alphabet>(
+        a_data,
+        a_out.data(),
+        a_ec,
+        a_strict,
+        a_pad_character,
+        detail::active_kernels().base32hex_decode,
+        state
+    );
 }
 
-auto base32_decode(
-    std::string_view const& a_data,
+auto base32hex_decode_inplace(
+    std::span<char> a_buffer,
     std::error_code& a_ec,
     bool a_strict,
     char a_pad_character
 )
--> std::vector<std::uint8_t>
+-> std::size_t
 {
-    return base32_decode_algo(
-        a_data,
+    // NOTE - The decoder never writes past the characters it has already read, so it can
+    //        overwrite its own input as it goes.
+    detail::decoder_state state;
+    return detail::codec_decode<base32hex_alphabet>(
+        std::string_view(a_buffer.data(), a_buffer.size()),
+        reinterpret_cast<std::uint8_t*>(a_buffer.data()),
         a_ec,
         a_strict,
         a_pad_character,
-        base32_decode_alpahbet
+        detail::active_kernels().base32hex_decode,
+        state
     );
 }
 
@@ -233,30 +409,227 @@ auto base32hex_decode(
 )
 -> std::vector<std::uint8_t>
 {
-    return base32_decode_algo(
+    std::vector<std::uint8_t> ret(base32_decoded_size(a_data, a_pad_character));
+    ret.resize(base32hex_decode_into(a_data, ret, a_ec, a_strict, a_pad_character));
+    return ret;
+}
+
+base32_encoder::base32_encoder(
+    bool a_padding,
+    char a_pad_character
+)
+    : base32_encoder(false, a_padding, a_pad_character)
+{
+}
+
+base32_encoder::base32_encoder(
+    bool a_url,
+    bool a_padding,
+    char a_pad_character
+)
+    : m_url(a_url)
+    , m_padding(a_padding)
+    , m_pad_character(a_pad_character)
+{
+}
+
+auto base32_encoder::max_update_size(std::size_t a_size) const -> std::size_t
+{
+    return ((m_state.carry_size + a_size) / 5) * 8;
+}
+
+auto base32_encoder::update(
+    std::span<std::uint8_t const> a_data,
+    std::span<char> a_out,
+    std::error_code& a_ec
+)
+-> std::size_t
+{
+    if (a_out.size() < max_update_size(a_data.size()))
+    {
+        a_ec = std::make_error_code(std::errc::no_buffer_space);
+        return 0;
+    }
+
+    auto const& kernels = detail::active_kernels();
+    auto const kernel = m_url ? kernels.base32hex_encode : kernels.base32_encode;
+
+    return detail::encode_update<5>(
+        m_state,
+        a_data,
+        a_out.data(),
+        [&](std::uint8_t const* a_in, std::size_t a_size, char* a_block_out)
+        {
+            kernel(a_in, a_size, a_block_out);
+            return (a_size / 5) * 8;
+        }
+    );
+}
+
+auto base32_encoder::finish(
+    std::span<char> a_out,
+    std::error_code& a_ec
+)
+-> std::size_t
+{
+    if (a_out.size() < base32_encoded_size(m_state.carry_size, m_padding))
+    {
+        a_ec = std::make_error_code(std::errc::no_buffer_space);
+        return 0;
+    }
+
+    auto const& kernels = detail::active_kernels();
+    std::size_t written = 0;
+
+    if (m_url)
+    {
+        written = detail::codec_encode<base32hex_alphabet>(
+            m_state.carry.data(),
+            m_state.carry_size,
+            a_out.data(),
+            m_padding,
+            m_pad_character,
+            kernels.base32hex_encode
+        );
+    } else
+    {
+        written = detail::codec_encode<base32_alphabet>(
+            m_state.carry.data(),
+            m_state.carry_size,
+            a_out.data(),
+            m_padding,
+            m_pad_character,
+            kernels.base32_encode
+        );
+    }
+
+    m_state = {};
+
+    return written;
+}
+
+base32hex_encoder::base32hex_encoder(
+    bool a_padding,
+    char a_pad_character
+)
+    : base32_encoder(true, a_padding, a_pad_character)
+{
+}
+
+base32_decoder::base32_decoder(
+    bool a_strict,
+    char a_pad_character
+)
+    : base32_decoder(false, a_strict, a_pad_character)
+{
+}
+
+base32_decoder::base32_decoder(
+    bool a_url,
+    bool a_strict,
+    char a_pad_character
+)
+    : m_url(a_url)
+    , m_strict(a_strict)
+    , m_pad_character(a_pad_character)
+{
+}
+
+auto base32_decoder::max_update_size(std::size_t a_size) const -> std::size_t
+{
+    return (m_state.num_bits + a_size * 5) / 8;
+}
+
+auto base32_decoder::update(
+    std::string_view const& a_data,
+    std::span<std::uint8_t> a_out,
+    std::error_code& a_ec
+)
+-> std::size_t
+{
+    if (a_out.size() < max_update_size(a_data.size()))
+    {
+        a_ec = std::make_error_code(std::errc::no_buffer_space);
+        return 0;
+    }
+
+    auto const& kernels = detail::active_kernels();
+
+    if (m_url)
+    {
+        return detail::codec_decode<base32hex_alphabet>(
+            a_data,
+            a_out.data(),
+            a_ec,
+            m_strict,
+            m_pad_character,
+            kernels.base32hex_decode,
+            m_state
+        );
+    }
+
+    return detail::codec_decode<base32_alphabet>(
         a_data,
+        a_out.data(),
         a_ec,
-        a_strict,
-        a_pad_character,
-        base32hex_decode_alpahbet
+        m_strict,
+        m_pad_character,
+        kernels.base32_decode,
+        m_state
     );
 }
 
+auto base32_decoder::finish(std::error_code& /* a_ec */) -> void
+{
+    m_state = {};
+}
+
+base32hex_decoder::base32hex_decoder(
+    bool a_strict,
+    char a_pad_character
+)
+    : base32_decoder(true, a_strict, a_pad_character)
+{
+}
+
 static auto is_base32_algo(
     std::string_view const& a_data,
+    validation_error& a_error,
     char a_pad_character,
-    std::unordered_map<char, uint8_t> const& a_verify_alphabet
+    detail::validate_kernel a_kernel
 )
 -> bool
 {
-    for (auto const datum : a_data)
+    // NOTE - Padding characters needed by a last block of each length, -1 for the lengths no
+    //        encoder produces.
+    static constexpr int padding_for_symbols[8] = {0, -1, 6, -1, 4, 3, -1, 1};
+
+    auto const symbols = a_kernel(a_data.data(), a_data.size());
+    auto const padding = padding_for_symbols[symbols % 8];
+
+    if (padding < 0)
     {
-        if (datum != a_pad_character && !a_verify_alphabet.contains(datum))
+        a_error = {symbols, symbols < a_data.size() ? a_data[symbols] : '\0'};
+        return false;
+    }
+
+    // NOTE - Whatever follows the symbols has to be exactly the padding of the last block, or
+    //        nothing at all.
+    for (auto pos = symbols; pos < a_data.size(); ++pos)
+    {
+        if (a_data[pos] != a_pad_character || pos - symbols >= static_cast<std::size_t>(padding))
         {
+            a_error = {pos, a_data[pos]};
             return false;
         }
     }
 
+    if (symbols != a_data.size() && a_data.size() - symbols != static_cast<std::size_t>(padding))
+    {
+        a_error = {a_data.size(), '\0'};
+        return false;
+    }
+
     return true;
 }
 
@@ -266,7 +639,23 @@ auto is_base32(
 )
 -> bool
 {
-    return is_base32_algo(a_data, a_pad_character, base32_decode_alpahbet);
+    validation_error error;
+    return is_base32_algo(a_data, error, a_pad_character, detail::active_kernels().base32_validate);
+}
+
+auto is_base32(
+    std::string_view const& a_data,
+    validation_error& a_error,
+    char a_pad_character
+)
+-> bool
+{
+    return is_base32_algo(
+        a_data,
+        a_error,
+        a_pad_character,
+        detail::active_kernels().base32_validate
+    );
 }
 
 auto is_base32hex(
@@ -275,7 +664,28 @@ auto is_base32hex(
 )
 -> bool
 {
-    return is_base32_algo(a_data, a_pad_character, base32hex_decode_alpahbet);
+    validation_error error;
+    return is_base32_algo(
+        a_data,
+        error,
+        a_pad_character,
+        detail::active_kernels().base32hex_validate
+    );
+}
+
+auto is_base32hex(
+    std::string_view const& a_data,
+    validation_error& a_error,
+    char a_pad_character
+)
+-> bool
+{
+    return is_base32_algo(
+        a_data,
+        a_error,
+        a_pad_character,
+        detail::active_kernels().base32hex_validate
+    );
 }
 
 }   // namespace base_codec
@@ -0,0 +1,322 @@
+#include "kernels.hpp"
+
+#include <bit>
+#include <cstring>
+#include <string_view>
+
+#include <immintrin.h>
+
+
+namespace rs
+{
+namespace base_codec
+{
+
+/**
+ * Both Base32 alphabets are made of two contiguous ASCII runs ('A'-'Z' and '2'-'7', or '0'-'9' and
+ * 'A'-'V'), so mapping between symbols and 5-bit values is one compare and one add per direction.
+ */
+struct base32_avx2_tables
+{
+    char split {};
+    char first_offset {};
+    char second_offset {};
+    char first_lo {};
+    char first_hi {};
+    char second_lo {};
+    char second_hi {};
+};
+
+static constexpr auto make_base32_avx2_tables(std::string_view a_alphabet) -> base32_avx2_tables
+{
+    std::size_t split = 1;
+
+    while (a_alphabet[split] == a_alphabet[split - 1] + 1)
+    {
+        ++split;
+    }
+
+    base32_avx2_tables ret;
+    ret.split = static_cast<char>(split);
+    ret.first_offset = a_alphabet[0];
+    ret.second_offset = static_cast<char>(a_alphabet[split] - static_cast<char>(split));
+    ret.first_lo = a_alphabet[0];
+    ret.first_hi = a_alphabet[split - 1];
+    ret.second_lo = a_alphabet[split];
+    ret.second_hi = a_alphabet[31];
+
+    return ret;
+}
+
+static constexpr auto base32_tables = make_base32_avx2_tables("ABCDEFGHIJKLMNOPQRSTUVWXYZ234567");
+static constexpr auto base32hex_tables = make_base32_avx2_tables("0123456789ABCDEFGHIJKLMNOPQRSTUV");
+
+static auto base32_encode_avx2_algo(
+    std::uint8_t const* a_in,
+    std::size_t a_size,
+    char* a_out,
+    base32_avx2_tables const& a_tables,
+    detail::encode_kernel a_tail
+)
+-> std::size_t
+{
+    // NOTE - Every symbol gets the two bytes holding its 5 bits as a big endian word, which is
+    //        then shifted right by a per symbol amount through a multiply-high.
+    auto const spread = _mm256_setr_epi8(
+        1, 0, 1, 0, 2, 1, 2, 1, 3, 2, 4, 3, 4, 3, 5, 4,
+        1, 0, 1, 0, 2, 1, 2, 1, 3, 2, 4, 3, 4, 3, 5, 4
+    );
+    auto const shifts = _mm256_setr_epi16(
+        1 << 5, 1 << 10, 1 << 7, 1 << 12, 1 << 9, 1 << 6, 1 << 11, 1 << 8,
+        1 << 5, 1 << 10, 1 << 7, 1 << 12, 1 << 9, 1 << 6, 1 << 11, 1 << 8
+    );
+    auto const index_mask = _mm256_set1_epi16(0x1F);
+    auto const split = _mm256_set1_epi8(static_cast<char>(a_tables.split - 1));
+    auto const first_offset = _mm256_set1_epi8(a_tables.first_offset);
+    auto const second_offset = _mm256_set1_epi8(a_tables.second_offset);
+
+    auto const load_blocks = [](std::uint8_t const* a_blocks)
+    {
+        return _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<__m128i const*>(a_blocks))),
+            _mm_loadu_si128(reinterpret_cast<__m128i const*>(a_blocks + 5)),
+            1
+        );
+    };
+
+    std::size_t consumed = 0;
+
+    // NOTE - Four blocks per iteration, one per 128-bit lane of two registers. The last load
+    //        starts at byte 15, so 31 bytes have to be readable.
+    for (; consumed + 31 <= a_size; consumed += 20, a_out += 32)
+    {
+        auto const first = _mm256_and_si256(
+            _mm256_mulhi_epu16(_mm256_shuffle_epi8(load_blocks(a_in + consumed), spread), shifts),
+            index_mask
+        );
+        auto const second = _mm256_and_si256(
+            _mm256_mulhi_epu16(
+                _mm256_shuffle_epi8(load_blocks(a_in + consumed + 10), spread),
+                shifts
+            ),
+            index_mask
+        );
+
+        // NOTE - The pack interleaves the lanes as [A C B D], so they get put back in order.
+        auto const indices = _mm256_permute4x64_epi64(
+            _mm256_packus_epi16(first, second),
+            0b11011000
+        );
+        auto const offsets = _mm256_blendv_epi8(
+            first_offset,
+            second_offset,
+            _mm256_cmpgt_epi8(indices, split)
+        );
+
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(a_out),
+            _mm256_add_epi8(indices, offsets)
+        );
+    }
+
+    return consumed + a_tail(a_in + consumed, a_size - consumed, a_out);
+}
+
+static auto base32_decode_avx2_algo(
+    char const* a_in,
+    std::size_t a_size,
+    std::uint8_t* a_out,
+    base32_avx2_tables const& a_tables,
+    detail::decode_kernel a_tail
+)
+-> std::size_t
+{
+    auto const first_lo = _mm256_set1_epi8(static_cast<char>(a_tables.first_lo - 1));
+    auto const first_hi = _mm256_set1_epi8(static_cast<char>(a_tables.first_hi + 1));
+    auto const second_lo = _mm256_set1_epi8(static_cast<char>(a_tables.second_lo - 1));
+    auto const second_hi = _mm256_set1_epi8(static_cast<char>(a_tables.second_hi + 1));
+    auto const first_offset = _mm256_set1_epi8(a_tables.first_offset);
+    auto const second_offset = _mm256_set1_epi8(a_tables.second_offset);
+    auto const low_dword = _mm256_set1_epi64x(0xFFFFFFFF);
+    auto const gather = _mm256_setr_epi8(
+        4, 3, 2, 1, 0, 12, 11, 10, 9, 8, -1, -1, -1, -1, -1, -1,
+        4, 3, 2, 1, 0, 12, 11, 10, 9, 8, -1, -1, -1, -1, -1, -1
+    );
+
+    std::size_t consumed = 0;
+
+    for (; consumed + 32 <= a_size; consumed += 32, a_out += 20)
+    {
+        auto const in = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(a_in + consumed));
+        auto const in_first = _mm256_and_si256(
+            _mm256_cmpgt_epi8(in, first_lo),
+            _mm256_cmpgt_epi8(first_hi, in)
+        );
+        auto const in_second = _mm256_and_si256(
+            _mm256_cmpgt_epi8(in, second_lo),
+            _mm256_cmpgt_epi8(second_hi, in)
+        );
+
+        // NOTE - Anything outside the alphabet (padding included) is left to the caller.
+        if (_mm256_movemask_epi8(_mm256_or_si256(in_first, in_second)) != -1)
+        {
+            break;
+        }
+
+        auto const values = _mm256_sub_epi8(
+            in,
+            _mm256_blendv_epi8(second_offset, first_offset, in_first)
+        );
+
+        // NOTE - 5-bit values -> 10-bit words -> 20-bit dwords -> 40 bits per qword.
+        auto const words = _mm256_maddubs_epi16(values, _mm256_set1_epi16(0x0120));
+        auto const dwords = _mm256_madd_epi16(words, _mm256_set1_epi32(0x00010400));
+        auto const qwords = _mm256_or_si256(
+            _mm256_slli_epi64(_mm256_and_si256(dwords, low_dword), 20),
+            _mm256_srli_epi64(dwords, 32)
+        );
+        auto const bytes = _mm256_shuffle_epi8(qwords, gather);
+
+        // NOTE - Exactly 10 bytes per lane, so nothing past the decoded output gets touched.
+        auto const lo = _mm256_castsi256_si128(bytes);
+        auto const hi = _mm256_extracti128_si256(bytes, 1);
+        auto const lo_tail = static_cast<std::uint16_t>(_mm_extract_epi16(lo, 4));
+        auto const hi_tail = static_cast<std::uint16_t>(_mm_extract_epi16(hi, 4));
+
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(a_out), lo);
+        std::memcpy(a_out + 8, &lo_tail, 2);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(a_out + 10), hi);
+        std::memcpy(a_out + 18, &hi_tail, 2);
+    }
+
+    return consumed + a_tail(a_in + consumed, a_size - consumed, a_out);
+}
+
+static auto base32_validate_avx2_algo(
+    char const* a_in,
+    std::size_t a_size,
+    base32_avx2_tables const& a_tables,
+    detail::validate_kernel a_tail
+)
+-> std::size_t
+{
+    auto const first_lo = _mm256_set1_epi8(static_cast<char>(a_tables.first_lo - 1));
+    auto const first_hi = _mm256_set1_epi8(static_cast<char>(a_tables.first_hi + 1));
+    auto const second_lo = _mm256_set1_epi8(static_cast<char>(a_tables.second_lo - 1));
+    auto const second_hi = _mm256_set1_epi8(static_cast<char>(a_tables.second_hi + 1));
+
+    std::size_t consumed = 0;
+
+    for (; consumed + 32 <= a_size; consumed += 32)
+    {
+        auto const in = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(a_in + consumed));
+        auto const in_first = _mm256_and_si256(
+            _mm256_cmpgt_epi8(in, first_lo),
+            _mm256_cmpgt_epi8(first_hi, in)
+        );
+        auto const in_second = _mm256_and_si256(
+            _mm256_cmpgt_epi8(in, second_lo),
+            _mm256_cmpgt_epi8(second_hi, in)
+        );
+        auto const valid = static_cast<std::uint32_t>(
+            _mm256_movemask_epi8(_mm256_or_si256(in_first, in_second))
+        );
+
+        if (valid != 0xFFFFFFFF)
+        {
+            return consumed + static_cast<std::size_t>(std::countr_one(valid));
+        }
+    }
+
+    return consumed + a_tail(a_in + consumed, a_size - consumed);
+}
+
+auto detail::base32_encode_avx2(
+    std::uint8_t const* a_in,
+    std::size_t a_size,
+    char* a_out
+)
+-> std::size_t
+{
+    return base32_encode_avx2_algo(
+        a_in,
+        a_size,
+        a_out,
+        base32_tables,
+        &detail::base32_encode_scalar
+    );
+}
+
+auto detail::base32hex_encode_avx2(
+    std::uint8_t const* a_in,
+    std::size_t a_size,
+    char* a_out
+)
+-> std::size_t
+{
+    return base32_encode_avx2_algo(
+        a_in,
+        a_size,
+        a_out,
+        base32hex_tables,
+        &detail::base32hex_encode_scalar
+    );
+}
+
+auto detail::base32_decode_avx2(
+    char const* a_in,
+    std::size_t a_size,
+    std::uint8_t* a_out
+)
+-> std::size_t
+{
+    return base32_decode_avx2_algo(
+        a_in,
+        a_size,
+        a_out,
+        base32_tables,
+        &detail::base32_decode_scalar
+    );
+}
+
+auto detail::base32hex_decode_avx2(
+    char const* a_in,
+    std::size_t a_size,
+    std::uint8_t* a_out
+)
+-> std::size_t
+{
+    return base32_decode_avx2_algo(
+        a_in,
+        a_size,
+        a_out,
+        base32hex_tables,
+        &detail::base32hex_decode_scalar
+    );
+}
+
+auto detail::base32_validate_avx2(
+    char const* a_in,
+    std::size_t a_size
+)
+-> std::size_t
+{
+    return base32_validate_avx2_algo(a_in, a_size, base32_tables, &detail::base32_validate_scalar);
+}
+
+auto detail::base32hex_validate_avx2(
+    char const* a_in,
+    std::size_t a_size
+)
+-> std::size_t
+{
+    return base32_validate_avx2_algo(
+        a_in,
+        a_size,
+        base32hex_tables,
+        &detail::base32hex_validate_scalar
+    );
+}
+
+}   // namespace base_codec
+}   // namespace rs
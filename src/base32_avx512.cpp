@@ -0,0 +1,280 @@
+#include "kernels.hpp"
+
+#include <array>
+#include <bit>
+#include <string_view>
+
+#include <immintrin.h>
+
+
+namespace rs
+{
+namespace base_codec
+{
+
+/**
+ * Lookup tables for the AVX-512 VBMI kernels. The 32 symbol alphabet is stored twice, so the
+ * byte permute can index it with the unmasked multishift output, and the 128 entry ASCII decode
+ * table (0x80 for anything outside the alphabet) takes two registers.
+ */
+struct base32_avx512_tables
+{
+    std::array<char, 64> encode {};
+    std::array<char, 128> decode {};
+};
+
+static constexpr auto make_base32_avx512_tables(std::string_view a_alphabet)
+-> base32_avx512_tables
+{
+    base32_avx512_tables ret;
+
+    for (std::size_t i = 0; i < ret.decode.size(); ++i)
+    {
+        ret.decode[i] = static_cast<char>(0x80);
+    }
+
+    for (std::size_t value = 0; value < a_alphabet.size(); ++value)
+    {
+        ret.encode[value] = a_alphabet[value];
+        ret.encode[value + 32] = a_alphabet[value];
+        ret.decode[static_cast<unsigned char>(a_alphabet[value])] = static_cast<char>(value);
+    }
+
+    return ret;
+}
+
+/**
+ * Byte permute that puts every 5 byte block into its own qword as a little endian 40-bit number.
+ */
+static constexpr auto make_base32_avx512_spread() -> std::array<char, 64>
+{
+    std::array<char, 64> ret {};
+
+    for (std::size_t block = 0; block < 8; ++block)
+    {
+        for (std::size_t i = 0; i < 5; ++i)
+        {
+            ret[block * 8 + i] = static_cast<char>(block * 5 + 4 - i);
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * Byte permute that gathers the 5 big endian output bytes out of every decoded 40-bit qword.
+ */
+static constexpr auto make_base32_avx512_pack() -> std::array<char, 64>
+{
+    std::array<char, 64> ret {};
+
+    for (std::size_t i = 0; i < 40; ++i)
+    {
+        ret[i] = static_cast<char>((i / 5) * 8 + 4 - (i % 5));
+    }
+
+    return ret;
+}
+
+static constexpr auto base32_tables = make_base32_avx512_tables(
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZ234567"
+);
+static constexpr auto base32hex_tables = make_base32_avx512_tables(
+    "0123456789ABCDEFGHIJKLMNOPQRSTUV"
+);
+static constexpr auto base32_spread = make_base32_avx512_spread();
+static constexpr auto base32_pack = make_base32_avx512_pack();
+
+static auto base32_encode_avx512_algo(
+    std::uint8_t const* a_in,
+    std::size_t a_size,
+    char* a_out,
+    base32_avx512_tables const& a_tables,
+    detail::encode_kernel a_tail
+)
+-> std::size_t
+{
+    auto const spread = _mm512_loadu_si512(base32_spread.data());
+    auto const shifts = _mm512_set1_epi64(0x00050A0F14191E23);
+    auto const alphabet = _mm512_loadu_si512(a_tables.encode.data());
+
+    std::size_t consumed = 0;
+
+    // NOTE - Eight blocks per iteration, one per qword.
+    for (; consumed + 40 <= a_size; consumed += 40, a_out += 64)
+    {
+        auto const in = _mm512_maskz_loadu_epi8(0x000000FFFFFFFFFF, a_in + consumed);
+        auto const indices = _mm512_multishift_epi64_epi8(
+            shifts,
+            _mm512_permutexvar_epi8(spread, in)
+        );
+
+        _mm512_storeu_si512(a_out, _mm512_permutexvar_epi8(indices, alphabet));
+    }
+
+    return consumed + a_tail(a_in + consumed, a_size - consumed, a_out);
+}
+
+static auto base32_decode_avx512_algo(
+    char const* a_in,
+    std::size_t a_size,
+    std::uint8_t* a_out,
+    base32_avx512_tables const& a_tables,
+    detail::decode_kernel a_tail
+)
+-> std::size_t
+{
+    auto const lookup_lo = _mm512_loadu_si512(a_tables.decode.data());
+    auto const lookup_hi = _mm512_loadu_si512(a_tables.decode.data() + 64);
+    auto const pack = _mm512_loadu_si512(base32_pack.data());
+    auto const low_dword = _mm512_set1_epi64(0xFFFFFFFF);
+
+    std::size_t consumed = 0;
+
+    for (; consumed + 64 <= a_size; consumed += 64, a_out += 40)
+    {
+        auto const in = _mm512_loadu_si512(a_in + consumed);
+        auto const values = _mm512_permutex2var_epi8(lookup_lo, in, lookup_hi);
+
+        // NOTE - Non-ASCII input has its own top bit set, everything else outside the alphabet
+        //        gets it from the table. Either way the block is left to the caller.
+        if (_mm512_movepi8_mask(_mm512_or_si512(values, in)) != 0)
+        {
+            break;
+        }
+
+        // NOTE - 5-bit values -> 10-bit words -> 20-bit dwords -> 40 bits per qword.
+        auto const words = _mm512_maddubs_epi16(values, _mm512_set1_epi16(0x0120));
+        auto const dwords = _mm512_madd_epi16(words, _mm512_set1_epi32(0x00010400));
+        auto const qwords = _mm512_or_si512(
+            _mm512_slli_epi64(_mm512_and_si512(dwords, low_dword), 20),
+            _mm512_srli_epi64(dwords, 32)
+        );
+
+        _mm512_mask_storeu_epi8(
+            a_out,
+            0x000000FFFFFFFFFF,
+            _mm512_permutexvar_epi8(pack, qwords)
+        );
+    }
+
+    return consumed + a_tail(a_in + consumed, a_size - consumed, a_out);
+}
+
+static auto base32_validate_avx512_algo(
+    char const* a_in,
+    std::size_t a_size,
+    base32_avx512_tables const& a_tables,
+    detail::validate_kernel a_tail
+)
+-> std::size_t
+{
+    auto const lookup_lo = _mm512_loadu_si512(a_tables.decode.data());
+    auto const lookup_hi = _mm512_loadu_si512(a_tables.decode.data() + 64);
+
+    std::size_t consumed = 0;
+
+    for (; consumed + 64 <= a_size; consumed += 64)
+    {
+        auto const in = _mm512_loadu_si512(a_in + consumed);
+        auto const values = _mm512_permutex2var_epi8(lookup_lo, in, lookup_hi);
+        auto const invalid = _mm512_movepi8_mask(_mm512_or_si512(values, in));
+
+        if (invalid != 0)
+        {
+            return consumed + static_cast<std::size_t>(std::countr_zero(invalid));
+        }
+    }
+
+    return consumed + a_tail(a_in + consumed, a_size - consumed);
+}
+
+auto detail::base32_encode_avx512(
+    std::uint8_t const* a_in,
+    std::size_t a_size,
+    char* a_out
+)
+-> std::size_t
+{
+    return base32_encode_avx512_algo(
+        a_in,
+        a_size,
+        a_out,
+        base32_tables,
+        &detail::base32_encode_avx2
+    );
+}
+
+auto detail::base32hex_encode_avx512(
+    std::uint8_t const* a_in,
+    std::size_t a_size,
+    char* a_out
+)
+-> std::size_t
+{
+    return base32_encode_avx512_algo(
+        a_in,
+        a_size,
+        a_out,
+        base32hex_tables,
+        &detail::base32hex_encode_avx2
+    );
+}
+
+auto detail::base32_decode_avx512(
+    char const* a_in,
+    std::size_t a_size,
+    std::uint8_t* a_out
+)
+-> std::size_t
+{
+    return base32_decode_avx512_algo(
+        a_in,
+        a_size,
+        a_out,
+        base32_tables,
+        &detail::base32_decode_avx2
+    );
+}
+
+auto detail::base32hex_decode_avx512(
+    char const* a_in,
+    std::size_t a_size,
+    std::uint8_t* a_out
+)
+-> std::size_t
+{
+    return base32_decode_avx512_algo(
+        a_in,
+        a_size,
+        a_out,
+        base32hex_tables,
+        &detail::base32hex_decode_avx2
+    );
+}
+
+auto detail::base32_validate_avx512(
+    char const* a_in,
+    std::size_t a_size
+)
+-> std::size_t
+{
+    return base32_validate_avx512_algo(a_in, a_size, base32_tables, &detail::base32_validate_avx2);
+}
+
+auto detail::base32hex_validate_avx512(
+    char const* a_in,
+    std::size_t a_size
+)
+-> std::size_t
+{
+    return base32_validate_avx512_algo(
+        a_in,
+        a_size,
+        base32hex_tables,
+        &detail::base32hex_validate_avx2
+    );
+}
+
+}   // namespace base_codec
+}   // namespace rs
@@ -1,10 +1,13 @@
 #include <base_codec/base64.hpp>
 
-#include <bitset>
-#include <sstream>
-#include <cassert>
-#include <stdexcept>
-#include <unordered_map>
+#include "swar.hpp"
+#include "codec.hpp"
+#include "inplace.hpp"
+#include "kernels.hpp"
+#include "streaming.hpp"
+
+#include <array>
+#include <cstring>
 
 
 namespace rs
@@ -12,129 +15,228 @@ namespace rs
 namespace base_codec
 {
 
-static std::vector<char> const base64_encode_alphabet = {
-    'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S',
-    'T', 'U', 'V', 'W', 'X', 'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l',
-    'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z', '0', '1', '2', '3', '4',
-    '5', '6', '7', '8', '9', '+', '/'
-};
-
-static std::vector<char> const base64url_encode_alphabet = {
-    'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S',
-    'T', 'U', 'V', 'W', 'X', 'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l',
-    'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z', '0', '1', '2', '3', '4',
-    '5', '6', '7', '8', '9', '-', '_'
-};
-
-static std::unordered_map<char, uint8_t> const base64_decode_alpahbet = {
-    {'A', 0}, {'B', 1}, {'C', 2}, {'D', 3}, {'E', 4}, {'F', 5}, {'G', 6}, {'H', 7}, {'I', 8},
-    {'J', 9}, {'K', 10}, {'L', 11}, {'M', 12}, {'N', 13}, {'O', 14}, {'P', 15}, {'Q', 16},
-    {'R', 17}, {'S', 18}, {'T', 19}, {'U', 20}, {'V', 21}, {'W', 22}, {'X', 23}, {'Y', 24},
-    {'Z', 25}, {'a', 26}, {'b', 27}, {'c', 28}, {'d', 29}, {'e', 30}, {'f', 31}, {'g', 32},
-    {'h', 33}, {'i', 34}, {'j', 35}, {'k', 36}, {'l', 37}, {'m', 38}, {'n', 39}, {'o', 40},
-    {'p', 41}, {'q', 42}, {'r', 43}, {'s', 44}, {'t', 45}, {'u', 46}, {'v', 47}, {'w', 48},
-    {'x', 49}, {'y', 50}, {'z', 51}, {'0', 52}, {'1', 53}, {'2', 54}, {'3', 55}, {'4', 56},
-    {'5', 57}, {'6', 58}, {'7', 59}, {'8', 60}, {'9', 61}, {'+', 62}, {'/', 63}
-};
-
-static std::unordered_map<char, uint8_t> const base64url_decode_alpahbet = {
-    {'A', 0}, {'B', 1}, {'C', 2}, {'D', 3}, {'E', 4}, {'F', 5}, {'G', 6}, {'H', 7}, {'I', 8},
-    {'J', 9}, {'K', 10}, {'L', 11}, {'M', 12}, {'N', 13}, {'O', 14}, {'P', 15}, {'Q', 16},
-    {'R', 17}, {'S', 18}, {'T', 19}, {'U', 20}, {'V', 21}, {'W', 22}, {'X', 23}, {'Y', 24},
-    {'Z', 25}, {'a', 26}, {'b', 27}, {'c', 28}, {'d', 29}, {'e', 30}, {'f', 31}, {'g', 32},
-    {'h', 33}, {'i', 34}, {'j', 35}, {'k', 36}, {'l', 37}, {'m', 38}, {'n', 39}, {'o', 40},
-    {'p', 41}, {'q', 42}, {'r', 43}, {'s', 44}, {'t', 45}, {'u', 46}, {'v', 47}, {'w', 48},
-    {'x', 49}, {'y', 50}, {'z', 51}, {'0', 52}, {'1', 53}, {'2', 54}, {'3', 55}, {'4', 56},
-    {'5', 57}, {'6', 58}, {'7', 59}, {'8', 60}, {'9', 61}, {'-', 62}, {'_', 63}
-};
-
-static auto base64_encode_algo(
-    std::vector<std::uint8_t> const& a_data,
-    std::error_code& a_ec,
-    bool a_padding,
-    char a_pad_character,
-    std::vector<char> const& a_encode_alphabet
+static constexpr auto base64_encode_pairs = detail::make_pair_table<6>(base64_alphabet::symbols);
+
+static constexpr auto base64url_encode_pairs = detail::make_pair_table<6>(
+    base64url_alphabet::symbols
+);
+
+static constexpr auto const& base64_decode_values = detail::decode_table<base64_alphabet>;
+
+static constexpr auto const& base64url_decode_values = detail::decode_table<base64url_alphabet>;
+
+static auto base64_encode_blocks(
+    std::uint8_t const* a_in,
+    std::size_t a_size,
+    char* a_out,
+    std::array<char, 8192> const& a_encode_pairs
 )
--> std::string
+-> std::size_t
 {
-    std::ostringstream s;
+    std::size_t consumed = 0;
+
+    // NOTE - Two blocks per step: 48 bits, four 12-bit pair lookups and one 8 byte store.
+    for (; consumed + 6 <= a_size; consumed += 6, a_out += 8)
+    {
+        auto const bit_buffer = detail::load_be<6>(a_in + consumed);
 
-    static std::bitset<24> const mask {0x3F};
-    std::uint64_t num_bits = 0;
-    std::bitset<24> bit_buffer {0};
+        detail::store_pairs(
+            a_out,
+            a_encode_pairs.data(),
+            bit_buffer >> 36,
+            (bit_buffer >> 24) & 0xFFF,
+            (bit_buffer >> 12) & 0xFFF,
+            bit_buffer & 0xFFF
+        );
+    }
 
-    for (auto const datum : a_data)
+    if (consumed + 3 <= a_size)
     {
-        bit_buffer <<= 8;
-        bit_buffer |= datum;
-        num_bits += 8;
+        auto const bit_buffer = detail::load_be<3>(a_in + consumed);
 
-        while (num_bits >= 6)
-        {
-            auto mask_at_pos = mask << (num_bits - 6);
-            auto idx = bit_buffer & mask_at_pos;
-            idx >>= num_bits - 6;
-            // bit_buffer &= ~mask_at_pos;
-            num_bits -= 6;
-            try
-            {
-                s << a_encode_alphabet.at(idx.to_ulong());
-            } catch (std::out_of_range const& e)
-            {
-                a_ec = std::make_error_code(std::errc::result_out_of_range);
-                assert(false && "you shouldn't be here");
-                return {};
-            }
-        }
+        std::memcpy(a_out, a_encode_pairs.data() + (bit_buffer >> 12) * 2, 2);
+        std::memcpy(a_out + 2, a_encode_pairs.data() + (bit_buffer & 0xFFF) * 2, 2);
+        consumed += 3;
     }
 
-    if (num_bits > 0)
+    return consumed;
+}
+
+static auto base64_decode_blocks(
+    char const* a_in,
+    std::size_t a_size,
+    std::uint8_t* a_out,
+    std::array<std::uint8_t, 256> const& a_decode_values
+)
+-> std::size_t
+{
+    auto const* symbols = reinterpret_cast<unsigned char const*>(a_in);
+    std::size_t consumed = 0;
+
+    // NOTE - Two blocks per step. Invalid characters map to 0xFF, so they only get looked for
+    //        once per step, in the OR of all the values.
+    for (; consumed + 8 <= a_size; consumed += 8, a_out += 6)
     {
-        try
+        std::uint64_t bit_buffer = 0;
+        std::uint32_t errors = 0;
+
+        for (std::size_t i = 0; i < 8; ++i)
         {
-            bit_buffer <<= 6 - num_bits;
-            s << a_encode_alphabet.at((bit_buffer & mask).to_ulong());
-        } catch (std::out_of_range const& e)
+            auto const value = a_decode_values[symbols[consumed + i]];
+            errors |= value;
+            bit_buffer = (bit_buffer << 6) | value;
+        }
+
+        if (errors & 0xC0)
         {
-            a_ec = std::make_error_code(std::errc::result_out_of_range);
-            assert(false && "you shouldn't be here");
-            return {};
+            break;
         }
+
+        detail::store_be<6>(a_out, bit_buffer);
     }
 
-    if (a_padding)
+    // NOTE - The last block, or the first half of a step that had an invalid character in it.
+    for (; consumed + 4 <= a_size; consumed += 4, a_out += 3)
     {
-        switch (a_data.size() % 3)
+        std::uint32_t bit_buffer = 0;
+        std::uint32_t errors = 0;
+
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            auto const value = a_decode_values[symbols[consumed + i]];
+            errors |= value;
+            bit_buffer = (bit_buffer << 6) | value;
+        }
+
+        if (errors & 0xC0)
         {
-        case 2:
-            s << std::string(1, a_pad_character);
-            break;
-        case 1:
-            s << std::string(2, a_pad_character);
-            break;
-        case 0:
-            break;
-        default:
-            assert(false && "you really shoudn't be here");
             break;
         }
+
+        detail::store_be<3>(a_out, bit_buffer);
     }
 
-    return s.str();
+    return consumed;
 }
 
-auto base64_encode(
-    std::vector<std::uint8_t> const& a_data,
+auto detail::base64_encode_scalar(
+    std::uint8_t const* a_in,
+    std::size_t a_size,
+    char* a_out
+)
+-> std::size_t
+{
+    return base64_encode_blocks(a_in, a_size, a_out, base64_encode_pairs);
+}
+
+auto detail::base64url_encode_scalar(
+    std::uint8_t const* a_in,
+    std::size_t a_size,
+    char* a_out
+)
+-> std::size_t
+{
+    return base64_encode_blocks(a_in, a_size, a_out, base64url_encode_pairs);
+}
+
+auto detail::base64_decode_scalar(
+    char const* a_in,
+    std::size_t a_size,
+    std::uint8_t* a_out
+)
+-> std::size_t
+{
+    return base64_decode_blocks(a_in, a_size, a_out, base64_decode_values);
+}
+
+auto detail::base64url_decode_scalar(
+    char const* a_in,
+    std::size_t a_size,
+    std::uint8_t* a_out
+)
+-> std::size_t
+{
+    return base64_decode_blocks(a_in, a_size, a_out, base64url_decode_values);
+}
+
+auto detail::base64_validate_scalar(
+    char const* a_in,
+    std::size_t a_size
+)
+-> std::size_t
+{
+    return detail::valid_prefix(a_in, a_size, base64_decode_values);
+}
+
+auto detail::base64url_validate_scalar(
+    char const* a_in,
+    std::size_t a_size
+)
+-> std::size_t
+{
+    return detail::valid_prefix(a_in, a_size, base64url_decode_values);
+}
+
+auto base64_encode_into(
+    std::span<std::uint8_t const> a_data,
+    std::span<char> a_out,
     std::error_code& a_ec,
     bool a_padding,
     char a_pad_character
 )
--> std::string
+-> std::size_t
 {
-    return base64_encode_algo(a_data, a_ec, a_padding, a_pad_character, base64_encode_alphabet);
+    if (a_out.size() < base64_encoded_size(a_data.size(), a_padding))
+    {
+        a_ec = std::make_error_code(std::errc::no_buffer_space);
+        return 0;
+    }
+
+    return detail::codec_encode<base64_alphabet>(
+        a_data.data(),
+        a_data.size(),
+        a_out.data(),
+        a_padding,
+        a_pad_character,
+        detail::active_kernels().base64_encode
+    );
 }
 
-auto base64url_encode(
+auto base64_encode_inplace(
+    std::span<char> a_buffer,
+    std::size_t a_size,
+    std::error_code& a_ec,
+    bool a_padding,
+    char a_pad_character
+)
+-> std::size_t
+{
+    if (a_size > a_buffer.size() || a_buffer.size() < base64_encoded_size(a_size, a_padding))
+    {
+        a_ec = std::make_error_code(std::errc::no_buffer_space);
+        return 0;
+    }
+
+    auto const kernel = detail::active_kernels().base64_encode;
+
+    return detail::encode_backwards<3, 4>(
+        a_buffer.data(),
+        a_size,
+        [&](std::uint8_t const* a_in, std::size_t a_in_size, char* a_out)
+        {
+            return detail::codec_encode<base64_alphabet>(
+                a_in,
+                a_in_size,
+                a_out,
+                a_padding,
+                a_pad_character,
+                kernel
+            );
+        }
+    );
+}
+
+auto base64_encode(
     std::vector<std::uint8_t> const& a_data,
     std::error_code& a_ec,
     bool a_padding,
@@ -142,61 +244,130 @@ auto base64url_encode(
 )
 -> std::string
 {
-    return base64_encode_algo(a_data, a_ec, a_padding, a_pad_character, base64url_encode_alphabet);
+    std::string ret(base64_encoded_size(a_data.size(), a_padding), '\0');
+    base64_encode_into(a_data, ret, a_ec, a_padding, a_pad_character);
+    return ret;
 }
 
-static auto base64_decode_algo(
-    std::string_view const& a_data,
+auto base64url_encode_into(
+    std::span<std::uint8_t const> a_data,
+    std::span<char> a_out,
     std::error_code& a_ec,
-    bool a_strict,
-    char a_pad_character,
-    std::unordered_map<char, uint8_t> const& a_decode_alphabet
+    bool a_padding,
+    char a_pad_character
 )
--> std::vector<std::uint8_t>
+-> std::size_t
 {
-    std::vector<std::uint8_t> ret;
-    ret.reserve((a_data.size() / 4) * 3);
+    if (a_out.size() < base64_encoded_size(a_data.size(), a_padding))
+    {
+        a_ec = std::make_error_code(std::errc::no_buffer_space);
+        return 0;
+    }
 
-    static std::bitset<24> const mask {0xFF};
-    std::uint64_t num_bits = 0;
-    std::bitset<24> bit_buffer;
+    return detail::codec_encode<base64url_alphabet>(
+        a_data.data(),
+        a_data.size(),
+        a_out.data(),
+        a_padding,
+        a_pad_character,
+        detail::active_kernels().base64url_encode
+    );
+}
 
-    for (auto const datum : a_data)
+auto base64url_encode_inplace(
+    std::span<char> a_buffer,
+    std::size_t a_size,
+    std::error_code& a_ec,
+    bool a_padding,
+    char a_pad_character
+)
+-> std::size_t
+{
+    if (a_size > a_buffer.size() || a_buffer.size() < base64_encoded_size(a_size, a_padding))
     {
-        if (datum == a_pad_character)
+        a_ec = std::make_error_code(std::errc::no_buffer_space);
+        return 0;
+    }
+
+    auto const kernel = detail::active_kernels().base64url_encode;
+
+    return detail::encode_backwards<3, 4>(
+        a_buffer.data(),
+        a_size,
+        [&](std::uint8_t const* a_in, std::size_t a_in_size, char* a_out)
         {
-            break;
+            return detail::codec_encode<base64url_alphabet>(
+                a_in,
+                a_in_size,
+                a_out,
+                a_padding,
+                a_pad_character,
+                kernel
+            );
         }
+    );
+}
 
-        try
-        {
-            std::uint8_t value = a_decode_alphabet.at(datum);
-            bit_buffer <<= 6;
-            bit_buffer |= value;
-            num_bits += 6;
-
-            while (num_bits >= 8)
-            {
-                auto mask_at_pos = mask << (num_bits - 8);
-                auto value = bit_buffer & mask_at_pos;
-                value >>= num_bits - 8;
-                ret.push_back(static_cast<std::uint8_t>(value.to_ulong()));
-                // bit_buffer &= ~mask_at_pos;
-                num_bits -= 8;
-            }
-        } catch (std::out_of_range const& e)
-        {
-            if (a_strict)
-            {
-                a_ec = std::make_error_code(std::errc::invalid_argument);
-                return {};
-            }
+auto base64url_encode(
+    std::vector<std::uint8_t> const& a_data,
+    std::error_code& a_ec,
+    bool a_padding,
+    char a_pad_character
+)
+-> std::string
+{
+    std::string ret(base64_encoded_size(a_data.size(), a_padding), '\0');
+    base64url_encode_into(a_data, ret, a_ec, a_padding, a_pad_character);
+    return ret;
+}
 
-            continue;
-        }
+auto base64_decode_into(
+    std::string_view const& a_data,
+    std::span<std::uint8_t> a_out,
+    std::error_code& a_ec,
+    bool a_strict,
+    char a_pad_character
+)
+-> std::size_t
+{
+    if (a_out.size() < base64_decoded_size(a_data, a_pad_character))
+    {
+        a_ec = std::make_error_code(std::errc::no_buffer_space);
+        return 0;
     }
 
-    return ret;
+    detail::decoder_state state;
+    return detail::codec_decode<base64_alphabet>(
+        a_data,
+        a_out.data(),
+        a_ec,
+        a_strict,
+        a_pad_character,
+        detail::active_kernels().base64_decode,
+        state
+    );
+}
+
+auto base64_decode_inplace(
+    std::span<char> a_buffer,
+    std::error_code& a_ec,
+    bool a_strict,
+    char a_pad_character
+)
+-> std::size_t
+{
+    // NOTE - The decoder never writes past the characters it has already read, so it can
+    //        overwrite its own input as it goes.
+    detail::decoder_state state;
+    return detail::codec_decode<base64_alphabet>(
+        std::string_view(a_buffer.data(), a_buffer.size()),
+        reinterpret_cast<std::uint8_t*>(a_buffer.data()),
+        a_ec,
+        a_strict,
+        a_pad_character,
+        detail::active_kernels().base64_decode,
+        state
+    );
 }
 
 auto base64_decode(
@@ -207,7 +378,58 @@ auto base64_decode(
 )
 -> std::vector<std::uint8_t>
 {
-    return base64_decode_algo(a_data, a_ec, a_strict, a_pad_character, base64_decode_alpahbet);
+    std::vector<std::uint8_t> ret(base64_decoded_size(a_data, a_pad_character));
+    ret.resize(base64_decode_into(a_data, ret, a_ec, a_strict, a_pad_character));
+    return ret;
+}
+
+auto base64url_decode_into(
+    std::string_view const& a_data,
+    std::span<std::uint8_t> a_out,
+    std::error_code& a_ec,
+    bool a_strict,
+    char a_pad_character
+)
+-> std::size_t
+{
+    if (a_out.size() < base64_decoded_size(a_data, a_pad_character))
+    {
+        a_ec = std::make_error_code(std::errc::no_buffer_space);
+        return 0;
+    }
+
+    detail::decoder_state state;
+    return detail::codec_decode<base64url_alphabet>(
+        a_data,
+        a_out.data(),
+        a_ec,
+        a_strict,
+        a_pad_character,
+        detail::active_kernels().base64url_decode,
+        state
+    );
+}
+
+auto base64url_decode_inplace(
+    std::span<char> a_buffer,
+    std::error_code& a_ec,
+    bool a_strict,
+    char a_pad_character
+)
+-> std::size_t
+{
+    // NOTE - The decoder never writes past the characters it has already read, so it can
+    //        overwrite its own input as it goes.
+    detail::decoder_state state;
+    return detail::codec_decode<base64url_alphabet>(
+        std::string_view(a_buffer.data(), a_buffer.size()),
+        reinterpret_cast<std::uint8_t*>(a_buffer.data()),
+        a_ec,
+        a_strict,
+        a_pad_character,
+        detail::active_kernels().base64url_decode,
+        state
+    );
 }
 
 auto base64url_decode(
@@ -218,24 +440,227 @@ auto base64url_decode(
 )
 -> std::vector<std::uint8_t>
 {
-    return base64_decode_algo(a_data, a_ec, a_strict, a_pad_character, base64url_decode_alpahbet);
+    std::vector<std::uint8_t> ret(base64_decoded_size(a_data, a_pad_character));
+    ret.resize(base64url_decode_into(a_data, ret, a_ec, a_strict, a_pad_character));
+    return ret;
+}
+
+base64_encoder::base64_encoder(
+    bool a_padding,
+    char a_pad_character
+)
+    : base64_encoder(false, a_padding, a_pad_character)
+{
+}
+
+base64_encoder::base64_encoder(
+    bool a_url,
+    bool a_padding,
+    char a_pad_character
+)
+    : m_url(a_url)
+    , m_padding(a_padding)
+    , m_pad_character(a_pad_character)
+{
+}
+
+auto base64_encoder::max_update_size(std::size_t a_size) const -> std::size_t
+{
+    return ((m_state.carry_size + a_size) / 3) * 4;
+}
+
+auto base64_encoder::update(
+    std::span<std::uint8_t const> a_data,
+    std::span<char> a_out,
+    std::error_code& a_ec
+)
+-> std::size_t
+{
+    if (a_out.size() < max_update_size(a_data.size()))
+    {
+        a_ec = std::make_error_code(std::errc::no_buffer_space);
+        return 0;
+    }
+
+    auto const& kernels = detail::active_kernels();
+    auto const kernel = m_url ? kernels.base64url_encode : kernels.base64_encode;
+
+    return detail::encode_update<3>(
+        m_state,
+        a_data,
+        a_out.data(),
+        [&](std::uint8_t const* a_in, std::size_t a_size, char* a_block_out)
+        {
+            kernel(a_in, a_size, a_block_out);
+            return (a_size / 3) * 4;
+        }
+    );
+}
+
+auto base64_encoder::finish(
+    std::span<char> a_out,
+    std::error_code& a_ec
+)
+-> std::size_t
+{
+    if (a_out.size() < base64_encoded_size(m_state.carry_size, m_padding))
+    {
+        a_ec = std::make_error_code(std::errc::no_buffer_space);
+        return 0;
+    }
+
+    auto const& kernels = detail::active_kernels();
+    std::size_t written = 0;
+
+    if (m_url)
+    {
+        written = detail::codec_encode<base64url_alphabet>(
+            m_state.carry.data(),
+            m_state.carry_size,
+            a_out.data(),
+            m_padding,
+            m_pad_character,
+            kernels.base64url_encode
+        );
+    } else
+    {
+        written = detail::codec_encode<base64_alphabet>(
+            m_state.carry.data(),
+            m_state.carry_size,
+            a_out.data(),
+            m_padding,
+            m_pad_character,
+            kernels.base64_encode
+        );
+    }
+
+    m_state = {};
+
+    return written;
+}
+
+base64url_encoder::base64url_encoder(
+    bool a_padding,
+    char a_pad_character
+)
+    : base64_encoder(true, a_padding, a_pad_character)
+{
+}
+
+base64_decoder::base64_decoder(
+    bool a_strict,
+    char a_pad_character
+)
+    : base64_decoder(false, a_strict, a_pad_character)
+{
+}
+
+base64_decoder::base64_decoder(
+    bool a_url,
+    bool a_strict,
+    char a_pad_character
+)
+    : m_url(a_url)
+    , m_strict(a_strict)
+    , m_pad_character(a_pad_character)
+{
+}
+
+auto base64_decoder::max_update_size(std::size_t a_size) const -> std::size_t
+{
+    return (m_state.num_bits + a_size * 6) / 8;
+}
+
+auto base64_decoder::update(
+    std::string_view const& a_data,
+    std::span<std::uint8_t> a_out,
+    std::error_code& a_ec
+)
+-> std::size_t
+{
+    if (a_out.size() < max_update_size(a_data.size()))
+    {
+        a_ec = std::make_error_code(std::errc::no_buffer_space);
+        return 0;
+    }
+
+    auto const& kernels = detail::active_kernels();
+
+    if (m_url)
+    {
+        return detail::codec_decode<base64url_alphabet>(
+            a_data,
+            a_out.data(),
+            a_ec,
+            m_strict,
+            m_pad_character,
+            kernels.base64url_decode,
+            m_state
+        );
+    }
+
+    return detail::codec_decode<base64_alphabet>(
+        a_data,
+        a_out.data(),
+        a_ec,
+        m_strict,
+        m_pad_character,
+        kernels.base64_decode,
+        m_state
+    );
+}
+
+auto base64_decoder::finish(std::error_code& /* a_ec */) -> void
+{
+    m_state = {};
+}
+
+base64url_decoder::base64url_decoder(
+    bool a_strict,
+    char a_pad_character
+)
+    : base64_decoder(true, a_strict, a_pad_character)
+{
 }
 
 static auto is_base64_algo(
     std::string_view const& a_data,
+    validation_error& a_error,
     char a_pad_character,
-    std::unordered_map<char, uint8_t> const& a_verify_alphabet
+    detail::validate_kernel a_kernel
 )
 -> bool
 {
-    for (auto const datum : a_data)
+    // NOTE - Padding characters needed by a last block of each length, -1 for the lengths no
+    //        encoder produces.
+    static constexpr int padding_for_symbols[4] = {0, -1, 2, 1};
+
+    auto const symbols = a_kernel(a_data.data(), a_data.size());
+    auto const padding = padding_for_symbols[symbols % 4];
+
+    if (padding < 0)
+    {
+        a_error = {symbols, symbols < a_data.size() ? a_data[symbols] : '\0'};
+        return false;
+    }
+
+    // NOTE - Whatever follows the symbols has to be exactly the padding of the last block, or
+    //        nothing at all.
+    for (auto pos = symbols; pos < a_data.size(); ++pos)
     {
-        if (datum != a_pad_character && !a_verify_alphabet.contains(datum))
+        if (a_data[pos] != a_pad_character || pos - symbols >= static_cast<std::size_t>(padding))
         {
+            a_error = {pos, a_data[pos]};
             return false;
         }
     }
 
+    if (symbols != a_data.size() && a_data.size() - symbols != static_cast<std::size_t>(padding))
+    {
+        a_error = {a_data.size(), '\0'};
+        return false;
+    }
+
     return true;
 }
 
@@ -245,16 +670,53 @@ auto is_base64(
 )
 -> bool
 {
-    return is_base64_algo(a_data, a_pad_character, base64_decode_alpahbet);
+    validation_error error;
+    return is_base64_algo(a_data, error, a_pad_character, detail::active_kernels().base64_validate);
+}
+
+auto is_base64(
+    std::string_view const& a_data,
+    validation_error& a_error,
+    char a_pad_character
+)
+-> bool
+{
+    return is_base64_algo(
+        a_data,
+        a_error,
+        a_pad_character,
+        detail::active_kernels().base64_validate
+    );
+}
+
+auto is_base64url(
+    std::string_view const& a_data,
+    char a_pad_character
+)
+-> bool
+{
+    validation_error error;
+    return is_base64_algo(
+        a_data,
+        error,
+        a_pad_character,
+        detail::active_kernels().base64url_validate
+    );
 }
 
 auto is_base64url(
     std::string_view const& a_data,
+    validation_error& a_error,
     char a_pad_character
 )
 -> bool
 {
-    return is_base64_algo(a_data, a_pad_character, base64url_decode_alpahbet);
+    return is_base64_algo(
+        a_data,
+        a_error,
+        a_pad_character,
+        detail::active_kernels().base64url_validate
+    );
 }
 
 }   // namespace base_codec
@@ -0,0 +1,445 @@
+#include "interleave.hpp"
+#include "kernels.hpp"
+
+#include <array>
+#include <bit>
+#include <string_view>
+
+#include <immintrin.h>
+
+
+namespace rs
+{
+namespace base_codec
+{
+
+/**
+ * Lookup tables for the AVX2 kernels, generated from the alphabet at compile time. The encoder
+ * maps every 6-bit index to an ASCII offset through a 16-entry `pshufb` table. The decoder
+ * classifies characters by their high and low nibble (a character is invalid when both lookups
+ * share a bit) and maps them back with a per high nibble offset. The one character which doesn't
+ * share its offset with the rest of its high nibble ('/' or '_') gets redirected to a spare slot.
+ */
+struct base64_avx2_tables
+{
+    std::array<char, 16> encode_offsets {};
+    std::array<char, 16> decode_lo {};
+    std::array<char, 16> decode_hi {};
+    std::array<char, 16> decode_offsets {};
+    char special {};
+    char special_delta {};
+};
+
+static constexpr auto make_base64_avx2_tables(std::string_view a_alphabet) -> base64_avx2_tables
+{
+    base64_avx2_tables ret;
+
+    // NOTE - Indices get reduced to 0 (26-51), 1-10 (52-61), 11 (62), 12 (63) or 13 (0-25).
+    ret.encode_offsets[0] = static_cast<char>(a_alphabet[26] - 26);
+
+    for (std::size_t i = 1; i <= 10; ++i)
+    {
+        ret.encode_offsets[i] = static_cast<char>(a_alphabet[52] - 52);
+    }
+
+    ret.encode_offsets[11] = static_cast<char>(a_alphabet[62] - 62);
+    ret.encode_offsets[12] = static_cast<char>(a_alphabet[63] - 63);
+    ret.encode_offsets[13] = a_alphabet[0];
+
+    constexpr auto invalid_hi = 0x40;
+
+    for (std::size_t hi = 0; hi < 16; ++hi)
+    {
+        ret.decode_hi[hi] = static_cast<char>(hi >= 2 && hi <= 7 ? 1 << (hi - 2) : invalid_hi);
+    }
+
+    for (std::size_t lo = 0; lo < 16; ++lo)
+    {
+        int bits = invalid_hi;
+
+        for (std::size_t hi = 2; hi <= 7; ++hi)
+        {
+            if (a_alphabet.find(static_cast<char>(hi << 4 | lo)) == std::string_view::npos)
+            {
+                bits |= 1 << (hi - 2);
+            }
+        }
+
+        ret.decode_lo[lo] = static_cast<char>(bits);
+    }
+
+    // NOTE - The last character of a high nibble run that breaks its offset is the special one.
+    //        Both alphabets have exactly one of those.
+    for (std::size_t value = 0; value < a_alphabet.size(); ++value)
+    {
+        auto const symbol = static_cast<unsigned char>(a_alphabet[value]);
+        auto const offset = static_cast<char>(static_cast<int>(value) - symbol);
+        auto const hi = symbol >> 4;
+
+        if (ret.decode_offsets[hi] == 0 || ret.decode_offsets[hi] == offset)
+        {
+            ret.decode_offsets[hi] = offset;
+            continue;
+        }
+
+        // NOTE - Slot 8 is never a valid high nibble, so it is free for the special character.
+        ret.special = static_cast<char>(symbol);
+        ret.special_delta = static_cast<char>(8 - hi);
+        ret.decode_offsets[8] = offset;
+    }
+
+    return ret;
+}
+
+static constexpr auto base64_tables = make_base64_avx2_tables(
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"
+);
+static constexpr auto base64url_tables = make_base64_avx2_tables(
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_"
+);
+
+static inline auto broadcast(std::array<char, 16> const& a_table) -> __m256i
+{
+    return _mm256_broadcastsi128_si256(
+        _mm_loadu_si128(reinterpret_cast<__m128i const*>(a_table.data()))
+    );
+}
+
+/**
+ * Maps 32 6-bit indices to their symbols.
+ */
+static inline auto base64_avx2_symbols(__m256i a_indices, __m256i a_offsets) -> __m256i
+{
+    auto reduced = _mm256_subs_epu8(a_indices, _mm256_set1_epi8(51));
+    auto const below_26 = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), a_indices);
+    reduced = _mm256_or_si256(reduced, _mm256_and_si256(below_26, _mm256_set1_epi8(13)));
+
+    return _mm256_add_epi8(_mm256_shuffle_epi8(a_offsets, reduced), a_indices);
+}
+
+static auto base64_encode_avx2_algo(
+    std::uint8_t const* a_in,
+    std::size_t a_size,
+    char* a_out,
+    base64_avx2_tables const& a_tables,
+    detail::encode_kernel a_tail
+)
+-> std::size_t
+{
+    auto const shuffle = _mm256_setr_epi8(
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10
+    );
+    auto const offsets = broadcast(a_tables.encode_offsets);
+
+    std::size_t consumed = 0;
+
+    // NOTE - Every iteration reads 28 bytes (two 16 byte loads, 12 bytes apart) and consumes 24.
+    for (; consumed + 28 <= a_size; consumed += 24, a_out += 32)
+    {
+        auto const lo = _mm_loadu_si128(reinterpret_cast<__m128i const*>(a_in + consumed));
+        auto const hi = _mm_loadu_si128(reinterpret_cast<__m128i const*>(a_in + consumed + 12));
+        auto in = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+
+        // NOTE - Every 3 bytes get spread over a dword as [b1 b0 b2 b1], then the four 6-bit
+        //        indices get moved into place with a multiply-high and a multiply-low.
+        in = _mm256_shuffle_epi8(in, shuffle);
+
+        auto const t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0FC0FC00));
+        auto const t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+        auto const t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003F03F0));
+        auto const t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+        auto const indices = _mm256_or_si256(t1, t3);
+
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(a_out),
+            base64_avx2_symbols(indices, offsets)
+        );
+    }
+
+    return consumed + a_tail(a_in + consumed, a_size - consumed, a_out);
+}
+
+static auto base64_encode_items_avx2_algo(
+    std::uint8_t const* a_in,
+    std::size_t a_item_size,
+    std::size_t a_items,
+    char* a_out,
+    std::size_t a_stride,
+    base64_avx2_tables const& a_tables
+)
+-> std::size_t
+{
+    auto const offsets = broadcast(a_tables.encode_offsets);
+    auto const low_bits = [](__m256i a_in, int a_bits)
+    {
+        return _mm256_and_si256(a_in, _mm256_set1_epi8(static_cast<char>((1 << a_bits) - 1)));
+    };
+
+    // NOTE - Every lane holds a byte of a different item, so 3 columns of bytes make 4 columns of
+    //        indices. The byte shifts are done on words, the masks dropping the bits which cross
+    //        over from the neighbouring byte.
+    return detail::encode_items_interleaved_avx2<12, 6>(
+        a_in,
+        a_item_size,
+        a_items,
+        a_out,
+        a_stride,
+        [&](detail::interleaved_block const& a_bytes, detail::interleaved_block& a_symbols)
+        {
+            for (std::size_t block = 0; block < 4; ++block)
+            {
+                auto const b0 = a_bytes[3 * block];
+                auto const b1 = a_bytes[3 * block + 1];
+                auto const b2 = a_bytes[3 * block + 2];
+
+                __m256i const indices[4] = {
+                    low_bits(_mm256_srli_epi16(b0, 2), 6),
+                    _mm256_or_si256(
+                        _mm256_slli_epi16(low_bits(b0, 2), 4),
+                        low_bits(_mm256_srli_epi16(b1, 4), 4)
+                    ),
+                    _mm256_or_si256(
+                        _mm256_slli_epi16(low_bits(b1, 4), 2),
+                        low_bits(_mm256_srli_epi16(b2, 6), 2)
+                    ),
+                    low_bits(b2, 6)
+                };
+
+                for (std::size_t i = 0; i < 4; ++i)
+                {
+                    a_symbols[4 * block + i] = base64_avx2_symbols(indices[i], offsets);
+                }
+            }
+        }
+    );
+}
+
+static auto base64_decode_avx2_algo(
+    char const* a_in,
+    std::size_t a_size,
+    std::uint8_t* a_out,
+    base64_avx2_tables const& a_tables,
+    detail::decode_kernel a_tail
+)
+-> std::size_t
+{
+    auto const lut_lo = broadcast(a_tables.decode_lo);
+    auto const lut_hi = broadcast(a_tables.decode_hi);
+    auto const lut_offsets = broadcast(a_tables.decode_offsets);
+    auto const special = _mm256_set1_epi8(a_tables.special);
+    auto const special_delta = _mm256_set1_epi8(a_tables.special_delta);
+    auto const nibble_mask = _mm256_set1_epi8(0x0F);
+    auto const shuffle = _mm256_setr_epi8(
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1
+    );
+    auto const permute = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);
+
+    std::size_t consumed = 0;
+
+    for (; consumed + 32 <= a_size; consumed += 32, a_out += 24)
+    {
+        auto const in = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(a_in + consumed));
+
+        auto const hi_nibbles = _mm256_and_si256(_mm256_srli_epi32(in, 4), nibble_mask);
+        auto const lo_nibbles = _mm256_and_si256(in, nibble_mask);
+        auto const hi = _mm256_shuffle_epi8(lut_hi, hi_nibbles);
+        auto const lo = _mm256_shuffle_epi8(lut_lo, lo_nibbles);
+
+        // NOTE - Anything outside the alphabet (padding included) is left to the caller.
+        if (!_mm256_testz_si256(lo, hi))
+        {
+            break;
+        }
+
+        auto const is_special = _mm256_cmpeq_epi8(in, special);
+        auto const slots = _mm256_add_epi8(
+            hi_nibbles,
+            _mm256_and_si256(is_special, special_delta)
+        );
+        auto const values = _mm256_add_epi8(in, _mm256_shuffle_epi8(lut_offsets, slots));
+
+        // NOTE - [00aaaaaa 00bbbbbb 00cccccc 00dddddd] -> 24 bits per dword, then compacted.
+        auto const pairs = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+        auto const words = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+        auto const bytes = _mm256_permutevar8x32_epi32(
+            _mm256_shuffle_epi8(words, shuffle),
+            permute
+        );
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(a_out), _mm256_castsi256_si128(bytes));
+        _mm_storel_epi64(
+            reinterpret_cast<__m128i*>(a_out + 16),
+            _mm256_extracti128_si256(bytes, 1)
+        );
+    }
+
+    return consumed + a_tail(a_in + consumed, a_size - consumed, a_out);
+}
+
+static auto base64_validate_avx2_algo(
+    char const* a_in,
+    std::size_t a_size,
+    base64_avx2_tables const& a_tables,
+    detail::validate_kernel a_tail
+)
+-> std::size_t
+{
+    auto const lut_lo = broadcast(a_tables.decode_lo);
+    auto const lut_hi = broadcast(a_tables.decode_hi);
+    auto const nibble_mask = _mm256_set1_epi8(0x0F);
+
+    std::size_t consumed = 0;
+
+    for (; consumed + 32 <= a_size; consumed += 32)
+    {
+        auto const in = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(a_in + consumed));
+
+        auto const hi = _mm256_shuffle_epi8(
+            lut_hi,
+            _mm256_and_si256(_mm256_srli_epi32(in, 4), nibble_mask)
+        );
+        auto const lo = _mm256_shuffle_epi8(lut_lo, _mm256_and_si256(in, nibble_mask));
+
+        // NOTE - A character is valid when its two lookups share no bit.
+        auto const valid = static_cast<std::uint32_t>(_mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(_mm256_and_si256(lo, hi), _mm256_setzero_si256())
+        ));
+
+        if (valid != 0xFFFFFFFF)
+        {
+            return consumed + static_cast<std::size_t>(std::countr_one(valid));
+        }
+    }
+
+    return consumed + a_tail(a_in + consumed, a_size - consumed);
+}
+
+auto detail::base64_encode_avx2(
+    std::uint8_t const* a_in,
+    std::size_t a_size,
+    char* a_out
+)
+-> std::size_t
+{
+    return base64_encode_avx2_algo(
+        a_in,
+        a_size,
+        a_out,
+        base64_tables,
+        &detail::base64_encode_scalar
+    );
+}
+
+auto detail::base64url_encode_avx2(
+    std::uint8_t const* a_in,
+    std::size_t a_size,
+    char* a_out
+)
+-> std::size_t
+{
+    return base64_encode_avx2_algo(
+        a_in,
+        a_size,
+        a_out,
+        base64url_tables,
+        &detail::base64url_encode_scalar
+    );
+}
+
+auto detail::base64_encode_items_avx2(
+    std::uint8_t const* a_in,
+    std::size_t a_item_size,
+    std::size_t a_items,
+    char* a_out,
+    std::size_t a_stride
+)
+-> std::size_t
+{
+    return base64_encode_items_avx2_algo(
+        a_in,
+        a_item_size,
+        a_items,
+        a_out,
+        a_stride,
+        base64_tables
+    );
+}
+
+auto detail::base64url_encode_items_avx2(
+    std::uint8_t const* a_in,
+    std::size_t a_item_size,
+    std::size_t a_items,
+    char* a_out,
+    std::size_t a_stride
+)
+-> std::size_t
+{
+    return base64_encode_items_avx2_algo(
+        a_in,
+        a_item_size,
+        a_items,
+        a_out,
+        a_stride,
+        base64url_tables
+    );
+}
+
+auto detail::base64_decode_avx2(
+    char const* a_in,
+    std::size_t a_size,
+    std::uint8_t* a_out
+)
+-> std::size_t
+{
+    return base64_decode_avx2_algo(
+        a_in,
+        a_size,
+        a_out,
+        base64_tables,
+        &detail::base64_decode_scalar
+    );
+}
+
+auto detail::base64url_decode_avx2(
+    char const* a_in,
+    std::size_t a_size,
+    std::uint8_t* a_out
+)
+-> std::size_t
+{
+    return base64_decode_avx2_algo(
+        a_in,
+        a_size,
+        a_out,
+        base64url_tables,
+        &detail::base64url_decode_scalar
+    );
+}
+
+auto detail::base64_validate_avx2(
+    char const* a_in,
+    std::size_t a_size
+)
+-> std::size_t
+{
+    return base64_validate_avx2_algo(a_in, a_size, base64_tables, &detail::base64_validate_scalar);
+}
+
+auto detail::base64url_validate_avx2(
+    char const* a_in,
+    std::size_t a_size
+)
+-> std::size_t
+{
+    return base64_validate_avx2_algo(
+        a_in,
+        a_size,
+        base64url_tables,
+        &detail::base64url_validate_scalar
+    );
+}
+
+}   // namespace base_codec
+}   // namespace rs
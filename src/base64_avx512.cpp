@@ -0,0 +1,260 @@
+#include "kernels.hpp"
+
+#include <array>
+#include <bit>
+#include <string_view>
+
+#include <immintrin.h>
+
+
+namespace rs
+{
+namespace base_codec
+{
+
+/**
+ * Lookup tables for the AVX-512 VBMI kernels. The whole 64 symbol alphabet fits in one zmm
+ * register and the 128 entry ASCII decode table (0x80 for anything outside the alphabet) in two,
+ * so both directions are a single byte permute away from the 6-bit indices.
+ */
+struct base64_avx512_tables
+{
+    std::array<char, 64> encode {};
+    std::array<char, 128> decode {};
+};
+
+static constexpr auto make_base64_avx512_tables(std::string_view a_alphabet)
+-> base64_avx512_tables
+{
+    base64_avx512_tables ret;
+
+    for (std::size_t i = 0; i < ret.decode.size(); ++i)
+    {
+        ret.decode[i] = static_cast<char>(0x80);
+    }
+
+    for (std::size_t value = 0; value < a_alphabet.size(); ++value)
+    {
+        ret.encode[value] = a_alphabet[value];
+        ret.decode[static_cast<unsigned char>(a_alphabet[value])] = static_cast<char>(value);
+    }
+
+    return ret;
+}
+
+/**
+ * Byte permute that gathers the 3 output bytes out of every decoded 24-bit dword.
+ */
+static constexpr auto make_base64_avx512_pack() -> std::array<char, 64>
+{
+    std::array<char, 64> ret {};
+
+    for (std::size_t i = 0; i < 48; ++i)
+    {
+        ret[i] = static_cast<char>((i / 3) * 4 + 2 - (i % 3));
+    }
+
+    return ret;
+}
+
+static constexpr auto base64_tables = make_base64_avx512_tables(
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"
+);
+static constexpr auto base64url_tables = make_base64_avx512_tables(
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_"
+);
+static constexpr auto base64_pack = make_base64_avx512_pack();
+
+static auto base64_encode_avx512_algo(
+    std::uint8_t const* a_in,
+    std::size_t a_size,
+    char* a_out,
+    base64_avx512_tables const& a_tables,
+    detail::encode_kernel a_tail
+)
+-> std::size_t
+{
+    // NOTE - Every 3 input bytes get spread over a dword as [b1 b0 b2 b1], after which a single
+    //        multishift pulls the four 6-bit indices out of it.
+    auto const spread = _mm512_setr_epi32(
+        0x01020001, 0x04050304, 0x07080607, 0x0A0B090A,
+        0x0D0E0C0D, 0x10110F10, 0x13141213, 0x16171516,
+        0x191A1819, 0x1C1D1B1C, 0x1F201E1F, 0x22232122,
+        0x25262425, 0x28292728, 0x2B2C2A2B, 0x2E2F2D2E
+    );
+    auto const shifts = _mm512_set1_epi64(0x3036242A1016040A);
+    auto const alphabet = _mm512_loadu_si512(a_tables.encode.data());
+
+    std::size_t consumed = 0;
+
+    for (; consumed + 48 <= a_size; consumed += 48, a_out += 64)
+    {
+        auto const in = _mm512_maskz_loadu_epi8(0x0000FFFFFFFFFFFF, a_in + consumed);
+        auto const indices = _mm512_multishift_epi64_epi8(
+            shifts,
+            _mm512_permutexvar_epi8(spread, in)
+        );
+
+        _mm512_storeu_si512(a_out, _mm512_permutexvar_epi8(indices, alphabet));
+    }
+
+    return consumed + a_tail(a_in + consumed, a_size - consumed, a_out);
+}
+
+static auto base64_decode_avx512_algo(
+    char const* a_in,
+    std::size_t a_size,
+    std::uint8_t* a_out,
+    base64_avx512_tables const& a_tables,
+    detail::decode_kernel a_tail
+)
+-> std::size_t
+{
+    auto const lookup_lo = _mm512_loadu_si512(a_tables.decode.data());
+    auto const lookup_hi = _mm512_loadu_si512(a_tables.decode.data() + 64);
+    auto const pack = _mm512_loadu_si512(base64_pack.data());
+
+    std::size_t consumed = 0;
+
+    for (; consumed + 64 <= a_size; consumed += 64, a_out += 48)
+    {
+        auto const in = _mm512_loadu_si512(a_in + consumed);
+        auto const values = _mm512_permutex2var_epi8(lookup_lo, in, lookup_hi);
+
+        // NOTE - Non-ASCII input has its own top bit set, everything else outside the alphabet
+        //        gets it from the table. Either way the block is left to the caller.
+        if (_mm512_movepi8_mask(_mm512_or_si512(values, in)) != 0)
+        {
+            break;
+        }
+
+        auto const pairs = _mm512_maddubs_epi16(values, _mm512_set1_epi32(0x01400140));
+        auto const words = _mm512_madd_epi16(pairs, _mm512_set1_epi32(0x00011000));
+
+        _mm512_mask_storeu_epi8(
+            a_out,
+            0x0000FFFFFFFFFFFF,
+            _mm512_permutexvar_epi8(pack, words)
+        );
+    }
+
+    return consumed + a_tail(a_in + consumed, a_size - consumed, a_out);
+}
+
+static auto base64_validate_avx512_algo(
+    char const* a_in,
+    std::size_t a_size,
+    base64_avx512_tables const& a_tables,
+    detail::validate_kernel a_tail
+)
+-> std::size_t
+{
+    auto const lookup_lo = _mm512_loadu_si512(a_tables.decode.data());
+    auto const lookup_hi = _mm512_loadu_si512(a_tables.decode.data() + 64);
+
+    std::size_t consumed = 0;
+
+    for (; consumed + 64 <= a_size; consumed += 64)
+    {
+        auto const in = _mm512_loadu_si512(a_in + consumed);
+        auto const values = _mm512_permutex2var_epi8(lookup_lo, in, lookup_hi);
+        auto const invalid = _mm512_movepi8_mask(_mm512_or_si512(values, in));
+
+        if (invalid != 0)
+        {
+            return consumed + static_cast<std::size_t>(std::countr_zero(invalid));
+        }
+    }
+
+    return consumed + a_tail(a_in + consumed, a_size - consumed);
+}
+
+auto detail::base64_encode_avx512(
+    std::uint8_t const* a_in,
+    std::size_t a_size,
+    char* a_out
+)
+-> std::size_t
+{
+    return base64_encode_avx512_algo(
+        a_in,
+        a_size,
+        a_out,
+        base64_tables,
+        &detail::base64_encode_avx2
+    );
+}
+
+auto detail::base64url_encode_avx512(
+    std::uint8_t const* a_in,
+    std::size_t a_size,
+    char* a_out
+)
+-> std::size_t
+{
+    return base64_encode_avx512_algo(
+        a_in,
+        a_size,
+        a_out,
+        base64url_tables,
+        &detail::base64url_encode_avx2
+    );
+}
+
+auto detail::base64_decode_avx512(
+    char const* a_in,
+    std::size_t a_size,
+    std::uint8_t* a_out
+)
+-> std::size_t
+{
+    return base64_decode_avx512_algo(
+        a_in,
+        a_size,
+        a_out,
+        base64_tables,
+        &detail::base64_decode_avx2
+    );
+}
+
+auto detail::base64url_decode_avx512(
+    char const* a_in,
+    std::size_t a_size,
+    std::uint8_t* a_out
+)
+-> std::size_t
+{
+    return base64_decode_avx512_algo(
+        a_in,
+        a_size,
+        a_out,
+        base64url_tables,
+        &detail::base64url_decode_avx2
+    );
+}
+
+auto detail::base64_validate_avx512(
+    char const* a_in,
+    std::size_t a_size
+)
+-> std::size_t
+{
+    return base64_validate_avx512_algo(a_in, a_size, base64_tables, &detail::base64_validate_avx2);
+}
+
+auto detail::base64url_validate_avx512(
+    char const* a_in,
+    std::size_t a_size
+)
+-> std::size_t
+{
+    return base64_validate_avx512_algo(
+        a_in,
+        a_size,
+        base64url_tables,
+        &detail::base64url_validate_avx2
+    );
+}
+
+}   // namespace base_codec
+}   // namespace rs
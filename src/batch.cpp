@@ -0,0 +1,489 @@
+#include <base_codec/batch.hpp>
+
+#include "codec.hpp"
+#include "kernels.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <limits>
+#include <string_view>
+#include <utility>
+
+
+namespace rs
+{
+namespace base_codec
+{
+
+/**
+ * Picks the item encode kernel of an alphabet out of a kernel table.
+ */
+template <typename Alphabet>
+static auto alphabet_items_kernel(detail::kernel_table const& a_table)
+-> detail::encode_items_kernel
+{
+    if constexpr (std::same_as<Alphabet, base16_alphabet>)
+    {
+        return a_table.base16_encode_items;
+    } else if constexpr (std::same_as<Alphabet, base64_alphabet>)
+    {
+        return a_table.base64_encode_items;
+    } else
+    {
+        return a_table.base64url_encode_items;
+    }
+}
+
+/**
+ * Number of characters encoding `a_size` bytes.
+ */
+template <typename Alphabet, bool Padding>
+static auto encoded_value_size(std::uint64_t a_size) -> std::uint64_t
+{
+    if constexpr (Padding && Alphabet::has_padding)
+    {
+        return (a_size + Alphabet::block_size - 1) / Alphabet::block_size * Alphabet::block_symbols;
+    } else
+    {
+        return (a_size * 8 + Alphabet::bits - 1) / Alphabet::bits;
+    }
+}
+
+/**
+ * Divides a value below 2^32 by a constant with a multiplication and a shift, which unlike the
+ * 64-bit division (or its 128-bit reciprocal) vectorizes as a 32x32->64-bit multiplication.
+ */
+template <std::uint64_t Divisor>
+static auto divide_small(std::uint64_t a_value) -> std::uint64_t
+{
+    constexpr auto log2 = std::bit_width(Divisor) - 1;
+
+    if constexpr (std::has_single_bit(Divisor))
+    {
+        return a_value >> log2;
+    } else
+    {
+        // NOTE - Round-up reciprocal, exact for every 32-bit value as long as its error is within
+        //        2^(shift - 32).
+        constexpr auto shift = 32 + log2;
+        constexpr auto multiplier = ((std::uint64_t {1} << shift) + Divisor - 1) / Divisor;
+        static_assert(multiplier <= std::numeric_limits<std::uint32_t>::max());
+        static_assert(multiplier * Divisor - (std::uint64_t {1} << shift) <= (1u << log2));
+
+        return static_cast<std::uint64_t>(static_cast<std::uint32_t>(a_value)) * multiplier >>
+               shift;
+    }
+}
+
+/**
+ * Same as `encoded_value_size`, branch and division free, for sizes below 2^32.
+ */
+template <typename Alphabet, bool Padding>
+static auto encoded_small_value_size(std::uint64_t a_size) -> std::uint64_t
+{
+    auto const blocks = divide_small<Alphabet::block_size>(a_size);
+    auto const rest = a_size - blocks * Alphabet::block_size;
+
+    if constexpr (Padding && Alphabet::has_padding)
+    {
+        return (blocks + (rest != 0)) * Alphabet::block_symbols;
+    } else
+    {
+        return blocks * Alphabet::block_symbols +
+               divide_small<Alphabet::bits>(rest * 8 + Alphabet::bits - 1);
+    }
+}
+
+/**
+ * Checks that the offsets are ascending and stay within the data buffer.
+ */
+template <typename Offset>
+static auto valid_offsets(
+    std::span<Offset const> a_offsets,
+    std::size_t a_data_size
+)
+-> bool
+{
+    if (a_offsets.empty())
+    {
+        return true;
+    }
+
+    // NOTE - No early exit, so the comparisons vectorize.
+    bool ascending = true;
+
+    for (std::size_t i = 1; i < a_offsets.size(); ++i)
+    {
+        ascending &= a_offsets[i - 1] <= a_offsets[i];
+    }
+
+    return ascending && a_offsets.front() >= 0 &&
+           static_cast<std::uint64_t>(a_offsets.back()) <= a_data_size;
+}
+
+template <typename Alphabet, bool Padding, typename Offset>
+static auto encode_batch_algo(
+    std::span<std::uint8_t const> a_data,
+    std::span<Offset const> a_offsets,
+    std::error_code& a_ec,
+    std::pmr::memory_resource* a_resource,
+    char a_pad_character
+)
+-> encoded_batch<Offset>
+{
+    using codec = detail::basic_codec<Alphabet, Padding, true>;
+
+    encoded_batch<Offset> ret {
+        std::pmr::string(a_resource),
+        std::pmr::vector<Offset>(a_resource)
+    };
+
+    if (!valid_offsets(a_offsets, a_data.size()))
+    {
+        a_ec = std::make_error_code(std::errc::invalid_argument);
+        return ret;
+    }
+
+    auto const values = a_offsets.empty() ? 0 : a_offsets.size() - 1;
+
+    // NOTE - First pass: the size of every encoded value only depends on the size of its input,
+    //        so the whole output gets sized (and allocated) up front.
+    //        Values within a buffer below 4 GiB take the vectorizable path.
+    std::uint64_t total = 0;
+
+    if (a_data.size() <= std::numeric_limits<std::uint32_t>::max())
+    {
+        for (std::size_t i = 0; i < values; ++i)
+        {
+            total += encoded_small_value_size<Alphabet, Padding>(
+                static_cast<std::uint64_t>(a_offsets[i + 1] - a_offsets[i])
+            );
+        }
+    } else
+    {
+        for (std::size_t i = 0; i < values; ++i)
+        {
+            total += encoded_value_size<Alphabet, Padding>(
+                static_cast<std::uint64_t>(a_offsets[i + 1] - a_offsets[i])
+            );
+        }
+    }
+
+    if (total > static_cast<std::uint64_t>(std::numeric_limits<Offset>::max()))
+    {
+        a_ec = std::make_error_code(std::errc::value_too_large);
+        return ret;
+    }
+
+    ret.data.resize(total);
+    ret.offsets.resize(values + 1);
+
+    auto const kernel = detail::alphabet_kernels<Alphabet>(detail::active_kernels()).first;
+    std::size_t out = 0;
+    ret.offsets[0] = 0;
+
+    for (std::size_t i = 0; i < values; ++i)
+    {
+        out += codec::encode(
+            a_data.data() + a_offsets[i],
+            static_cast<std::size_t>(a_offsets[i + 1] - a_offsets[i]),
+            ret.data.data() + out,
+            a_pad_character,
+            kernel
+        );
+        ret.offsets[i + 1] = static_cast<Offset>(out);
+    }
+
+    return ret;
+}
+
+template <typename Alphabet, bool Strict, typename Offset>
+static auto decode_batch_algo(
+    std::span<char const> a_data,
+    std::span<Offset const> a_offsets,
+    std::error_code& a_ec,
+    std::pmr::memory_resource* a_resource,
+    char a_pad_character
+)
+-> decoded_batch<Offset>
+{
+    using codec = detail::basic_codec<Alphabet, true, Strict>;
+
+    decoded_batch<Offset> ret {
+        std::pmr::vector<std::uint8_t>(a_resource),
+        std::pmr::vector<Offset>(a_resource)
+    };
+
+    if (!valid_offsets(a_offsets, a_data.size()))
+    {
+        a_ec = std::make_error_code(std::errc::invalid_argument);
+        return ret;
+    }
+
+    auto const values = a_offsets.empty() ? 0 : a_offsets.size() - 1;
+
+    // NOTE - First pass: an upper bound of the decoded size, exact for inputs without padding or
+    //        skipped characters. Decoding never grows the data, so the offsets can't overflow.
+    std::uint64_t total = 0;
+
+    for (std::size_t i = 0; i < values; ++i)
+    {
+        total += static_cast<std::uint64_t>(a_offsets[i + 1] - a_offsets[i]) * Alphabet::bits / 8;
+    }
+
+    ret.data.resize(total);
+    ret.offsets.resize(values + 1);
+
+    auto const kernel = detail::alphabet_kernels<Alphabet>(detail::active_kernels()).second;
+    std::size_t out = 0;
+    ret.offsets[0] = 0;
+
+    for (std::size_t i = 0; i < values; ++i)
+    {
+        detail::decoder_state state;
+        std::error_code ec;
+
+        out += codec::decode(
+            std::string_view(
+                a_data.data() + a_offsets[i],
+                static_cast<std::size_t>(a_offsets[i + 1] - a_offsets[i])
+            ),
+            ret.data.data() + out,
+            ec,
+            a_pad_character,
+            kernel,
+            state
+        );
+
+        // NOTE - Strict Base16 doesn't accept a dangling digit either, like `base16_decode`.
+        if constexpr (Strict && !Alphabet::has_padding)
+        {
+            if (state.num_bits != 0)
+            {
+                ec = std::make_error_code(std::errc::invalid_argument);
+            }
+        }
+
+        if (ec)
+        {
+            a_ec = ec;
+            ret.data.clear();
+            ret.offsets.clear();
+            return ret;
+        }
+
+        ret.offsets[i + 1] = static_cast<Offset>(out);
+    }
+
+    ret.data.resize(out);
+
+    return ret;
+}
+
+template <typename Alphabet, bool Padding>
+static auto encode_items_algo(
+    std::span<std::uint8_t const> a_data,
+    std::size_t a_item_size,
+    std::error_code& a_ec,
+    std::pmr::memory_resource* a_resource,
+    char a_pad_character
+)
+-> std::pmr::string
+{
+    using codec = detail::basic_codec<Alphabet, Padding, true>;
+
+    std::pmr::string ret(a_resource);
+
+    if (a_item_size == 0 || a_data.size() % a_item_size != 0)
+    {
+        a_ec = std::make_error_code(std::errc::invalid_argument);
+        return ret;
+    }
+
+    auto const items = a_data.size() / a_item_size;
+    auto const stride = static_cast<std::size_t>(
+        encoded_value_size<Alphabet, Padding>(a_item_size)
+    );
+
+    ret.resize(items * stride);
+
+    auto const& kernels = detail::active_kernels();
+
+    auto const prefix = alphabet_items_kernel<Alphabet>(kernels)(
+        a_data.data(),
+        a_item_size,
+        items,
+        ret.data(),
+        stride
+    );
+
+    // NOTE - A kernel which encoded whole items only left their padding behind. Otherwise the
+    //        partial block and padding of every item are left to the codec.
+    if (prefix == a_item_size)
+    {
+        auto const symbols = static_cast<std::size_t>(
+            encoded_value_size<Alphabet, false>(a_item_size)
+        );
+
+        if (symbols != stride)
+        {
+            for (std::size_t i = 0; i < items; ++i)
+            {
+                std::fill_n(ret.data() + i * stride + symbols, stride - symbols, a_pad_character);
+            }
+        }
+
+        return ret;
+    }
+
+    auto const kernel = detail::alphabet_kernels<Alphabet>(kernels).first;
+    auto const prefix_symbols = prefix / Alphabet::block_size * Alphabet::block_symbols;
+
+    for (std::size_t i = 0; i < items; ++i)
+    {
+        codec::encode(
+            a_data.data() + i * a_item_size + prefix,
+            a_item_size - prefix,
+            ret.data() + i * stride + prefix_symbols,
+            a_pad_character,
+            kernel
+        );
+    }
+
+    return ret;
+}
+
+template <typename Alphabet, batch_offset Offset>
+auto detail::encode_batch(
+    std::span<std::uint8_t const> a_data,
+    std::span<Offset const> a_offsets,
+    std::error_code& a_ec,
+    std::pmr::memory_resource* a_resource,
+    bool a_padding,
+    char a_pad_character
+)
+-> encoded_batch<Offset>
+{
+    if (a_padding)
+    {
+        return encode_batch_algo<Alphabet, true>(
+            a_data,
+            a_offsets,
+            a_ec,
+            a_resource,
+            a_pad_character
+        );
+    }
+
+    return encode_batch_algo<Alphabet, false>(a_data, a_offsets, a_ec, a_resource, a_pad_character);
+}
+
+template <typename Alphabet, batch_offset Offset>
+auto detail::decode_batch(
+    std::span<char const> a_data,
+    std::span<Offset const> a_offsets,
+    std::error_code& a_ec,
+    std::pmr::memory_resource* a_resource,
+    bool a_strict,
+    char a_pad_character
+)
+-> decoded_batch<Offset>
+{
+    if (a_strict)
+    {
+        return decode_batch_algo<Alphabet, true>(
+            a_data,
+            a_offsets,
+            a_ec,
+            a_resource,
+            a_pad_character
+        );
+    }
+
+    return decode_batch_algo<Alphabet, false>(a_data, a_offsets, a_ec, a_resource, a_pad_character);
+}
+
+template <typename Alphabet>
+auto detail::encode_items(
+    std::span<std::uint8_t const> a_data,
+    std::size_t a_item_size,
+    std::error_code& a_ec,
+    std::pmr::memory_resource* a_resource,
+    bool a_padding,
+    char a_pad_character
+)
+-> std::pmr::string
+{
+    if (a_padding)
+    {
+        return encode_items_algo<Alphabet, true>(
+            a_data,
+            a_item_size,
+            a_ec,
+            a_resource,
+            a_pad_character
+        );
+    }
+
+    return encode_items_algo<Alphabet, false>(
+        a_data,
+        a_item_size,
+        a_ec,
+        a_resource,
+        a_pad_character
+    );
+}
+
+#define BASE_CODEC_INSTANTIATE_BATCH(ALPHABET, OFFSET) \
+    template auto detail::encode_batch<ALPHABET, OFFSET>( \
+        std::span<std::uint8_t const>, \
+        std::span<OFFSET const>, \
+        std::error_code&, \
+        std::pmr::memory_resource*, \
+        bool, \
+        char \
+    ) \
+    -> encoded_batch<OFFSET>; \
+    template auto detail::decode_batch<ALPHABET, OFFSET>( \
+        std::span<char const>, \
+        std::span<OFFSET const>, \
+        std::error_code&, \
+        std::pmr::memory_resource*, \
+        bool, \
+        char \
+    ) \
+    -> decoded_batch<OFFSET>;
+
+BASE_CODEC_INSTANTIATE_BATCH(base16_alphabet, std::int32_t)
+BASE_CODEC_INSTANTIATE_BATCH(base16_alphabet, std::int64_t)
+BASE_CODEC_INSTANTIATE_BATCH(base32_alphabet, std::int32_t)
+BASE_CODEC_INSTANTIATE_BATCH(base32_alphabet, std::int64_t)
+BASE_CODEC_INSTANTIATE_BATCH(base32hex_alphabet, std::int32_t)
+BASE_CODEC_INSTANTIATE_BATCH(base32hex_alphabet, std::int64_t)
+BASE_CODEC_INSTANTIATE_BATCH(base64_alphabet, std::int32_t)
+BASE_CODEC_INSTANTIATE_BATCH(base64_alphabet, std::int64_t)
+BASE_CODEC_INSTANTIATE_BATCH(base64url_alphabet, std::int32_t)
+BASE_CODEC_INSTANTIATE_BATCH(base64url_alphabet, std::int64_t)
+
+#undef BASE_CODEC_INSTANTIATE_BATCH
+
+#define BASE_CODEC_INSTANTIATE_ITEMS(ALPHABET) \
+    template auto detail::encode_items<ALPHABET>( \
+        std::span<std::uint8_t const>, \
+        std::size_t, \
+        std::error_code&, \
+        std::pmr::memory_resource*, \
+        bool, \
+        char \
+    ) \
+    -> std::pmr::string;
+
+BASE_CODEC_INSTANTIATE_ITEMS(base16_alphabet)
+BASE_CODEC_INSTANTIATE_ITEMS(base64_alphabet)
+BASE_CODEC_INSTANTIATE_ITEMS(base64url_alphabet)
+
+#undef BASE_CODEC_INSTANTIATE_ITEMS
+
+}   // namespace base_codec
+}   // namespace rs
@@ -0,0 +1,301 @@
+/**
+ * @file codec.hpp
+ *
+ * The codec shared by all alphabets. The kernels handle whole blocks, `basic_codec` the partial
+ * blocks, padding and strict/lenient rules around them, with every option fixed at compile time.
+ */
+#pragma once
+
+#include <base_codec/alphabet.hpp>
+#include <base_codec/stream.hpp>
+
+#include "kernels.hpp"
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+
+namespace rs
+{
+namespace base_codec
+{
+namespace detail
+{
+
+/**
+ * Encoder/decoder for one alphabet, with padding and strict mode as compile time options.
+ *
+ * @tparam Alphabet One of the alphabets from alphabet.hpp.
+ * @tparam Padding Should the encoding be padded to whole blocks.
+ * @tparam Strict Should decoding fail on characters outside the alphabet, rather than skip them.
+ */
+template <typename Alphabet, bool Padding, bool Strict>
+struct basic_codec
+{
+    static constexpr auto const& decode_values = decode_table<Alphabet>;
+    static constexpr std::uint32_t symbol_mask = (1u << Alphabet::bits) - 1;
+
+    /**
+     * Encodes a whole input, or the last chunk of one, and returns the number of characters
+     * written. The kernel encodes the whole blocks, the partial block left behind gets padded on
+     * the right with 0 bits to make whole symbols.
+     */
+    static auto encode(
+        std::uint8_t const* a_in,
+        std::size_t a_size,
+        char* a_out,
+        char a_pad_character,
+        encode_kernel a_kernel
+    )
+    -> std::size_t
+    {
+        auto const consumed = a_kernel(a_in, a_size, a_out);
+        auto const remaining = a_size - consumed;
+        std::size_t out = (consumed / Alphabet::block_size) * Alphabet::block_symbols;
+
+        if (remaining > 0)
+        {
+            std::uint64_t bit_buffer = 0;
+
+            for (std::size_t i = 0; i < remaining; ++i)
+            {
+                bit_buffer = (bit_buffer << 8) | a_in[consumed + i];
+            }
+
+            auto const symbols = (remaining * 8 + Alphabet::bits - 1) / Alphabet::bits;
+            bit_buffer <<= symbols * Alphabet::bits - remaining * 8;
+
+            for (std::size_t i = symbols; i-- > 0;)
+            {
+                auto const value = (bit_buffer >> (i * Alphabet::bits)) & symbol_mask;
+                a_out[out++] = Alphabet::symbols[value];
+            }
+        }
+
+        if constexpr (Padding && Alphabet::has_padding)
+        {
+            while (out % Alphabet::block_symbols != 0)
+            {
+                a_out[out++] = a_pad_character;
+            }
+        }
+
+        return out;
+    }
+
+    /**
+     * Decodes the next chunk of an input and returns the number of bytes written, or 0 on error.
+     * Bits of a partial byte and the padding state are kept in `a_state` for the next chunk.
+     */
+    static auto decode(
+        std::string_view const& a_data,
+        std::uint8_t* a_out,
+        std::error_code& a_ec,
+        char a_pad_character,
+        decode_kernel a_kernel,
+        decoder_state& a_state
+    )
+    -> std::size_t
+    {
+        if (a_state.padded)
+        {
+            return 0;
+        }
+
+        // NOTE - The kernels don't know about the padding character, so they can't be trusted
+        //        with a padding character that is also part of the alphabet.
+        bool const use_kernel = !Alphabet::has_padding ||
+                                decode_values[static_cast<unsigned char>(a_pad_character)] ==
+                                invalid_symbol;
+
+        std::size_t pos = 0;
+        std::size_t out = 0;
+        auto& num_bits = a_state.num_bits;
+        auto& bit_buffer = a_state.bit_buffer;
+
+        while (pos < a_data.size())
+        {
+            // NOTE - Whenever we are on a block boundary the kernel gets to decode as much as it
+            //        can and we only walk through the blocks it refuses one character at a time.
+            if (num_bits == 0 && use_kernel)
+            {
+                auto const consumed = a_kernel(
+                    a_data.data() + pos,
+                    a_data.size() - pos,
+                    a_out + out
+                );
+                pos += consumed;
+                out += (consumed / Alphabet::block_symbols) * Alphabet::block_size;
+
+                if (pos == a_data.size())
+                {
+                    break;
+                }
+            }
+
+            auto const datum = a_data[pos++];
+
+            if constexpr (Alphabet::has_padding)
+            {
+                if (datum == a_pad_character)
+                {
+                    a_state.padded = true;
+                    break;
+                }
+            }
+
+            auto const value = decode_values[static_cast<unsigned char>(datum)];
+
+            if (value == invalid_symbol)
+            {
+                if constexpr (Strict)
+                {
+                    a_ec = std::make_error_code(std::errc::invalid_argument);
+                    return 0;
+                } else
+                {
+                    continue;
+                }
+            }
+
+            bit_buffer = (bit_buffer << Alphabet::bits) | value;
+            num_bits += Alphabet::bits;
+
+            if (num_bits >= 8)
+            {
+                num_bits -= 8;
+                a_out[out++] = static_cast<std::uint8_t>(bit_buffer >> num_bits);
+            }
+        }
+
+        return out;
+    }
+};
+
+/**
+ * Picks the kernels of an alphabet out of a kernel table.
+ */
+template <typename Alphabet>
+auto alphabet_kernels(kernel_table const& a_table) -> std::pair<encode_kernel, decode_kernel>
+{
+    if constexpr (std::same_as<Alphabet, base16_alphabet>)
+    {
+        return {a_table.base16_encode, a_table.base16_decode};
+    } else if constexpr (std::same_as<Alphabet, base32_alphabet>)
+    {
+        return {a_table.base32_encode, a_table.base32_decode};
+    } else if constexpr (std::same_as<Alphabet, base32hex_alphabet>)
+    {
+        return {a_table.base32hex_encode, a_table.base32hex_decode};
+    } else if constexpr (std::same_as<Alphabet, base64_alphabet>)
+    {
+        return {a_table.base64_encode, a_table.base64_decode};
+    } else
+    {
+        return {a_table.base64url_encode, a_table.base64url_decode};
+    }
+}
+
+/**
+ * Picks the validate kernel of an alphabet out of a kernel table.
+ */
+template <typename Alphabet>
+auto alphabet_validate_kernel(kernel_table const& a_table) -> validate_kernel
+{
+    if constexpr (std::same_as<Alphabet, base16_alphabet>)
+    {
+        return a_table.base16_validate;
+    } else if constexpr (std::same_as<Alphabet, base32_alphabet>)
+    {
+        return a_table.base32_validate;
+    } else if constexpr (std::same_as<Alphabet, base32hex_alphabet>)
+    {
+        return a_table.base32hex_validate;
+    } else if constexpr (std::same_as<Alphabet, base64_alphabet>)
+    {
+        return a_table.base64_validate;
+    } else
+    {
+        return a_table.base64url_validate;
+    }
+}
+
+/**
+ * Picks the `basic_codec` encoder for a runtime padding option.
+ */
+template <typename Alphabet>
+auto codec_encode(
+    std::uint8_t const* a_in,
+    std::size_t a_size,
+    char* a_out,
+    bool a_padding,
+    char a_pad_character,
+    encode_kernel a_kernel
+)
+-> std::size_t
+{
+    if (a_padding)
+    {
+        return basic_codec<Alphabet, true, true>::encode(
+            a_in,
+            a_size,
+            a_out,
+            a_pad_character,
+            a_kernel
+        );
+    }
+
+    return basic_codec<Alphabet, false, true>::encode(
+        a_in,
+        a_size,
+        a_out,
+        a_pad_character,
+        a_kernel
+    );
+}
+
+/**
+ * Picks the `basic_codec` decoder for a runtime strict option.
+ */
+template <typename Alphabet>
+auto codec_decode(
+    std::string_view const& a_data,
+    std::uint8_t* a_out,
+    std::error_code& a_ec,
+    bool a_strict,
+    char a_pad_character,
+    decode_kernel a_kernel,
+    decoder_state& a_state
+)
+-> std::size_t
+{
+    if (a_strict)
+    {
+        return basic_codec<Alphabet, true, true>::decode(
+            a_data,
+            a_out,
+            a_ec,
+            a_pad_character,
+            a_kernel,
+            a_state
+        );
+    }
+
+    return basic_codec<Alphabet, true, false>::decode(
+        a_data,
+        a_out,
+        a_ec,
+        a_pad_character,
+        a_kernel,
+        a_state
+    );
+}
+
+}   // namespace detail
+}   // namespace base_codec
+}   // namespace rs
@@ -0,0 +1,179 @@
+#include <base_codec/dispatch.hpp>
+
+#include "kernels.hpp"
+
+#include <atomic>
+#include <cstdlib>
+
+
+namespace rs
+{
+namespace base_codec
+{
+
+static auto detect_best_kernel_tier() -> kernel_tier
+{
+#if defined(BASE_CODEC_NATIVE)
+    return detail::native_kernels.tier;
+#elif defined(BASE_CODEC_X86)
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx512f") &&
+        __builtin_cpu_supports("avx512bw") &&
+        __builtin_cpu_supports("avx512vbmi"))
+    {
+        return kernel_tier::avx512;
+    }
+
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return kernel_tier::avx2;
+    }
+
+    if (__builtin_cpu_supports("sse4.1"))
+    {
+        return kernel_tier::sse41;
+    }
+
+    return kernel_tier::scalar;
+#else
+    return kernel_tier::scalar;
+#endif
+}
+
+auto kernel_tier_name(kernel_tier a_tier) -> std::string_view
+{
+    switch (a_tier)
+    {
+    case kernel_tier::scalar:
+        return "scalar";
+    case kernel_tier::sse41:
+        return "sse41";
+    case kernel_tier::avx2:
+        return "avx2";
+    case kernel_tier::avx512:
+        return "avx512";
+    }
+
+    return "unknown";
+}
+
+auto best_kernel_tier() -> kernel_tier
+{
+    static kernel_tier const best = detect_best_kernel_tier();
+    return best;
+}
+
+auto is_kernel_tier_supported(kernel_tier a_tier) -> bool
+{
+#if defined(BASE_CODEC_NATIVE)
+    return a_tier == detail::native_kernels.tier;
+#else
+    return a_tier <= best_kernel_tier();
+#endif
+}
+
+#if defined(BASE_CODEC_NATIVE)
+
+auto active_kernel_tier() -> kernel_tier
+{
+    return detail::native_kernels.tier;
+}
+
+auto set_kernel_tier(
+    kernel_tier a_tier,
+    std::error_code& a_ec
+)
+-> void
+{
+    if (a_tier != detail::native_kernels.tier)
+    {
+        a_ec = std::make_error_code(std::errc::operation_not_supported);
+    }
+}
+
+#else
+
+static auto kernels_for_tier(kernel_tier a_tier) -> detail::kernel_table const&
+{
+    switch (a_tier)
+    {
+#if defined(BASE_CODEC_X86)
+    case kernel_tier::avx512:
+        return detail::avx512_kernels;
+    case kernel_tier::avx2:
+        return detail::avx2_kernels;
+    case kernel_tier::sse41:
+        return detail::sse41_kernels;
+#endif
+    default:
+        return detail::scalar_kernels;
+    }
+}
+
+static auto resolve_kernel_tier() -> kernel_tier
+{
+    auto const best = best_kernel_tier();
+    char const* forced = std::getenv("BASE_CODEC_KERNEL");
+
+    if (forced == nullptr)
+    {
+        return best;
+    }
+
+    for (auto const tier : {
+        kernel_tier::scalar, kernel_tier::sse41, kernel_tier::avx2, kernel_tier::avx512
+    })
+    {
+        if (kernel_tier_name(tier) == forced)
+        {
+            // NOTE - Asking for more than the CPU has clamps down instead of crashing later on
+            //        an illegal instruction.
+            return tier < best ? tier : best;
+        }
+    }
+
+    return best;
+}
+
+static std::atomic<detail::kernel_table const*> active_kernel_table {nullptr};
+
+auto detail::active_kernels() -> detail::kernel_table const&
+{
+    auto const* table = active_kernel_table.load(std::memory_order_acquire);
+
+    if (table == nullptr)
+    {
+        // NOTE - Racing first calls all resolve to the same table, so there is no need for
+        //        anything stronger than a plain store.
+        table = &kernels_for_tier(resolve_kernel_tier());
+        active_kernel_table.store(table, std::memory_order_release);
+    }
+
+    return *table;
+}
+
+auto active_kernel_tier() -> kernel_tier
+{
+    return detail::active_kernels().tier;
+}
+
+auto set_kernel_tier(
+    kernel_tier a_tier,
+    std::error_code& a_ec
+)
+-> void
+{
+    if (!is_kernel_tier_supported(a_tier))
+    {
+        a_ec = std::make_error_code(std::errc::operation_not_supported);
+        return;
+    }
+
+    active_kernel_table.store(&kernels_for_tier(a_tier), std::memory_order_release);
+}
+
+#endif
+
+}   // namespace base_codec
+}   // namespace rs
@@ -0,0 +1,85 @@
+/**
+ * @file inplace.hpp
+ *
+ * Helper behind the in-place encoders, which expand the data within its own buffer.
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+
+namespace rs
+{
+namespace base_codec
+{
+namespace detail
+{
+
+/**
+ * Encodes the first `a_size` bytes of a buffer into the same buffer, back to front.
+ *
+ * The data gets split into chunks from the end. The invariant everything rests on is that the
+ * output window of a chunk [start, end) - which begins at `start / BlockSize * SymbolsPerBlock` -
+ * starts at or after `end`, the end of the input that is still unread. The encoding of a chunk
+ * thus only overwrites the output of chunks already encoded (and the free space after the data),
+ * never its own input nor anything before it, so the ordinary forward kernels can be used as they
+ * are - they are never asked to alias their input. The chunk start is the lowest block boundary
+ * satisfying this, `ceil(end / SymbolsPerBlock) * BlockSize`, so every chunk covers roughly the
+ * last (Symbols - Block) / Symbols of what is left.
+ *
+ * Once no such chunk is left, the remaining head is shorter than `BlockSize * SymbolsPerBlock /
+ * (SymbolsPerBlock - BlockSize)` bytes (12 for Base64, 13 for Base32, 2 for Base16). It gets
+ * copied into a 64 byte buffer and encoded from there to the front of the buffer.
+ *
+ * `a_encode` is called as `a_encode(std::uint8_t const* a_in, std::size_t a_size, char* a_out)`
+ * and returns the number of characters written. Every chunk but the first one encoded (the end of
+ * the data) is made of whole blocks, so any padding ends up where it belongs.
+ */
+template <std::size_t BlockSize, std::size_t SymbolsPerBlock, typename Encoder>
+auto encode_backwards(
+    char* a_buffer,
+    std::size_t a_size,
+    Encoder&& a_encode
+)
+-> std::size_t
+{
+    static_assert(BlockSize * SymbolsPerBlock / (SymbolsPerBlock - BlockSize) <= 64);
+
+    auto* const bytes = reinterpret_cast<std::uint8_t*>(a_buffer);
+
+    std::size_t written = 0;
+    std::size_t end = a_size;
+
+    while (end > 0)
+    {
+        auto const start = ((end + SymbolsPerBlock - 1) / SymbolsPerBlock) * BlockSize;
+
+        if (start >= end)
+        {
+            break;
+        }
+
+        written += a_encode(
+            bytes + start,
+            end - start,
+            a_buffer + (start / BlockSize) * SymbolsPerBlock
+        );
+        end = start;
+    }
+
+    if (end > 0)
+    {
+        std::array<std::uint8_t, 64> head;
+        std::memcpy(head.data(), bytes, end);
+        written += a_encode(head.data(), end, a_buffer);
+    }
+
+    return written;
+}
+
+}   // namespace detail
+}   // namespace base_codec
+}   // namespace rs
@@ -0,0 +1,197 @@
+/**
+ * @file interleave.hpp
+ *
+ * Lane interleaved encoding of many small equal sized items with AVX2. Rather than encoding one
+ * short item per call and leaving most of every vector unused, 32 items are transposed so that
+ * every byte lane holds one item, encoded together column by column and transposed back. Only to
+ * be included from the sources built for the AVX2 tier.
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <immintrin.h>
+
+
+namespace rs
+{
+namespace base_codec
+{
+namespace detail
+{
+
+// NOTE - A plain array, as std::array would drop the alignment attributes of the vector type.
+using interleaved_block = __m256i[16];
+
+/**
+ * Transposes the two 16x16 byte matrices held in the 128-bit lanes of `a_rows`.
+ */
+inline auto transpose_16x16_avx2(interleaved_block& a_rows) -> void
+{
+    // NOTE - Interleaving row i with row i + 8 into rows 2i and 2i + 1 rotates the 8 bits of the
+    //        (row, byte) index left by one, so four rounds swap rows and bytes.
+    for (int round = 0; round < 4; ++round)
+    {
+        interleaved_block next;
+
+        for (std::size_t i = 0; i < 8; ++i)
+        {
+            next[2 * i] = _mm256_unpacklo_epi8(a_rows[i], a_rows[i + 8]);
+            next[2 * i + 1] = _mm256_unpackhi_epi8(a_rows[i], a_rows[i + 8]);
+        }
+
+        std::memcpy(a_rows, next, sizeof(next));
+    }
+}
+
+/**
+ * Loads a 16 byte row of which only the first `a_size` bytes are used, without reading past
+ * `a_end`.
+ */
+inline auto load_interleaved_row(
+    std::uint8_t const* a_in,
+    std::size_t a_size,
+    std::uint8_t const* a_end
+)
+-> __m128i
+{
+    if (a_end - a_in >= 16)
+    {
+        return _mm_loadu_si128(reinterpret_cast<__m128i const*>(a_in));
+    }
+
+    std::array<std::uint8_t, 16> row {};
+    std::memcpy(row.data(), a_in, a_size);
+
+    return _mm_loadu_si128(reinterpret_cast<__m128i const*>(row.data()));
+}
+
+/**
+ * Stores the first `a_size` characters of a 16 character row.
+ */
+inline auto store_interleaved_row(char* a_out, __m128i a_row, std::size_t a_size) -> void
+{
+    if (a_size == 16)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(a_out), a_row);
+        return;
+    }
+
+    std::array<char, 16> row;
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(row.data()), a_row);
+    std::memcpy(a_out, row.data(), a_size);
+}
+
+/**
+ * Item encode kernel over `InChunk` byte chunks of every item, each encoded into 16 characters.
+ * Encodes whole items but for their padding, the last chunk of every item being zero extended.
+ *
+ * @tparam InChunk Bytes of an item encoded per step, a multiple of the block size.
+ * @tparam Bits Bits per symbol.
+ * @tparam Transform Maps the `InChunk` input columns of a step onto its 16 output columns.
+ */
+template <std::size_t InChunk, std::size_t Bits, typename Transform>
+auto encode_items_interleaved_avx2(
+    std::uint8_t const* a_in,
+    std::size_t a_item_size,
+    std::size_t a_items,
+    char* a_out,
+    std::size_t a_stride,
+    Transform a_transform
+)
+-> std::size_t
+{
+    auto const chunks = (a_item_size + InChunk - 1) / InChunk;
+    auto const symbols = (a_item_size * 8 + Bits - 1) / Bits;
+    auto const end = a_in + a_item_size * a_items;
+
+    // NOTE - The bytes of a row past the end of its chunk belong to the next chunk or item. The
+    //        transform only looks at the first `InChunk` columns, so only the bytes of the last,
+    //        partial, chunk need clearing.
+    static constexpr std::array<std::int8_t, 32> ones {
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+    };
+    auto const last_size = a_item_size - (chunks - 1) * InChunk;
+    auto const last_mask = _mm_loadu_si128(
+        reinterpret_cast<__m128i const*>(ones.data() + 16 - last_size)
+    );
+
+    // NOTE - The low 128-bit lanes hold items [first, first + 16), the high lanes the next 16.
+    //        Rows of items past the end are left at 0 and never stored.
+    for (std::size_t first = 0; first < a_items; first += 32)
+    {
+        for (std::size_t chunk = 0; chunk < chunks; ++chunk)
+        {
+            auto const is_last = chunk + 1 == chunks;
+            auto const in_size = is_last ? last_size : InChunk;
+            auto const out_size = std::min<std::size_t>(16, symbols - chunk * 16);
+
+            interleaved_block rows;
+
+            for (std::size_t row = 0; row < 16; ++row)
+            {
+                __m128i halves[2] = {_mm_setzero_si128(), _mm_setzero_si128()};
+
+                for (std::size_t half = 0; half < 2; ++half)
+                {
+                    auto const item = first + half * 16 + row;
+
+                    if (item < a_items)
+                    {
+                        halves[half] = load_interleaved_row(
+                            a_in + item * a_item_size + chunk * InChunk,
+                            in_size,
+                            end
+                        );
+                    }
+                }
+
+                rows[row] = _mm256_set_m128i(halves[1], halves[0]);
+
+                if (is_last)
+                {
+                    rows[row] = _mm256_and_si256(rows[row], _mm256_set_m128i(last_mask, last_mask));
+                }
+            }
+
+            transpose_16x16_avx2(rows);
+
+            interleaved_block columns;
+            a_transform(rows, columns);
+
+            transpose_16x16_avx2(columns);
+
+            for (std::size_t row = 0; row < 16; ++row)
+            {
+                __m128i const halves[2] = {
+                    _mm256_castsi256_si128(columns[row]),
+                    _mm256_extracti128_si256(columns[row], 1)
+                };
+
+                for (std::size_t half = 0; half < 2; ++half)
+                {
+                    auto const item = first + half * 16 + row;
+
+                    if (item < a_items)
+                    {
+                        store_interleaved_row(
+                            a_out + item * a_stride + chunk * 16,
+                            halves[half],
+                            out_size
+                        );
+                    }
+                }
+            }
+        }
+    }
+
+    return a_item_size;
+}
+
+}   // namespace detail
+}   // namespace base_codec
+}   // namespace rs
@@ -0,0 +1,299 @@
+/**
+ * @file kernels.hpp
+ *
+ * Internal kernel tables used by the public routines to reach the instruction set specific
+ * implementations.
+ */
+#pragma once
+
+#include <base_codec/dispatch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace rs
+{
+namespace base_codec
+{
+namespace detail
+{
+
+/**
+ * Encode kernels process every whole input block (1 byte for Base16, 5 for Base32 and 3 for
+ * Base64) and return the number of input bytes consumed. The trailing partial block and the
+ * padding are left to the caller.
+ */
+using encode_kernel = std::size_t (*)(std::uint8_t const* a_in, std::size_t a_size, char* a_out);
+
+/**
+ * Decode kernels process whole blocks (2, 8 or 4 characters) for as long as every character of
+ * the block belongs to the alphabet, and return the number of characters consumed. They stop in
+ * front of the first block holding padding or an invalid character, leaving it to the caller to
+ * apply the strict/lenient rules.
+ */
+using decode_kernel = std::size_t (*)(char const* a_in, std::size_t a_size, std::uint8_t* a_out);
+
+/**
+ * Validate kernels return the length of the longest prefix made only of alphabet characters,
+ * which is also the offset of the first character outside the alphabet (padding included).
+ */
+using validate_kernel = std::size_t (*)(char const* a_in, std::size_t a_size);
+
+/**
+ * Item encode kernels encode `a_items` equal sized items stored back to back, the output of item
+ * `i` starting at `a_out + i * a_stride`. They process the same prefix of every item and return
+ * its size in bytes - either the whole block prefix, leaving the partial block of every item to
+ * the caller, or the whole item, leaving only the padding.
+ */
+using encode_items_kernel = std::size_t (*)(
+    std::uint8_t const* a_in,
+    std::size_t a_item_size,
+    std::size_t a_items,
+    char* a_out,
+    std::size_t a_stride
+);
+
+struct kernel_table
+{
+    kernel_tier tier;
+
+    encode_kernel base16_encode;
+    decode_kernel base16_decode;
+    validate_kernel base16_validate;
+    encode_items_kernel base16_encode_items;
+
+    encode_kernel base32_encode;
+    encode_kernel base32hex_encode;
+    decode_kernel base32_decode;
+    decode_kernel base32hex_decode;
+    validate_kernel base32_validate;
+    validate_kernel base32hex_validate;
+
+    encode_kernel base64_encode;
+    encode_kernel base64url_encode;
+    decode_kernel base64_decode;
+    decode_kernel base64url_decode;
+    validate_kernel base64_validate;
+    validate_kernel base64url_validate;
+    encode_items_kernel base64_encode_items;
+    encode_items_kernel base64url_encode_items;
+};
+
+/**
+ * Item encode kernel running a single item encode kernel over every item in turn.
+ */
+template <encode_kernel Kernel, std::size_t BlockSize>
+auto encode_items_each(
+    std::uint8_t const* a_in,
+    std::size_t a_item_size,
+    std::size_t a_items,
+    char* a_out,
+    std::size_t a_stride
+)
+-> std::size_t
+{
+    auto const prefix = a_item_size / BlockSize * BlockSize;
+
+    for (std::size_t i = 0; i < a_items; ++i)
+    {
+        Kernel(a_in + i * a_item_size, prefix, a_out + i * a_stride);
+    }
+
+    return prefix;
+}
+
+// NOTE - Portable kernels, defined next to the public routines in src/base*.cpp.
+auto base16_encode_scalar(std::uint8_t const* a_in, std::size_t a_size, char* a_out) -> std::size_t;
+auto base16_decode_scalar(char const* a_in, std::size_t a_size, std::uint8_t* a_out) -> std::size_t;
+auto base32_encode_scalar(std::uint8_t const* a_in, std::size_t a_size, char* a_out) -> std::size_t;
+auto base32hex_encode_scalar(std::uint8_t const* a_in, std::size_t a_size, char* a_out) -> std::size_t;
+auto base32_decode_scalar(char const* a_in, std::size_t a_size, std::uint8_t* a_out) -> std::size_t;
+auto base32hex_decode_scalar(char const* a_in, std::size_t a_size, std::uint8_t* a_out) -> std::size_t;
+auto base64_encode_scalar(std::uint8_t const* a_in, std::size_t a_size, char* a_out) -> std::size_t;
+auto base64url_encode_scalar(std::uint8_t const* a_in, std::size_t a_size, char* a_out) -> std::size_t;
+auto base64_decode_scalar(char const* a_in, std::size_t a_size, std::uint8_t* a_out) -> std::size_t;
+auto base64url_decode_scalar(char const* a_in, std::size_t a_size, std::uint8_t* a_out) -> std::size_t;
+
+auto base16_validate_scalar(char const* a_in, std::size_t a_size) -> std::size_t;
+auto base32_validate_scalar(char const* a_in, std::size_t a_size) -> std::size_t;
+auto base32hex_validate_scalar(char const* a_in, std::size_t a_size) -> std::size_t;
+auto base64_validate_scalar(char const* a_in, std::size_t a_size) -> std::size_t;
+auto base64url_validate_scalar(char const* a_in, std::size_t a_size) -> std::size_t;
+
+inline constexpr kernel_table scalar_kernels {
+    kernel_tier::scalar,
+    &base16_encode_scalar,
+    &base16_decode_scalar,
+    &base16_validate_scalar,
+    &encode_items_each<&base16_encode_scalar, 1>,
+    &base32_encode_scalar,
+    &base32hex_encode_scalar,
+    &base32_decode_scalar,
+    &base32hex_decode_scalar,
+    &base32_validate_scalar,
+    &base32hex_validate_scalar,
+    &base64_encode_scalar,
+    &base64url_encode_scalar,
+    &base64_decode_scalar,
+    &base64url_decode_scalar,
+    &base64_validate_scalar,
+    &base64url_validate_scalar,
+    &encode_items_each<&base64_encode_scalar, 3>,
+    &encode_items_each<&base64url_encode_scalar, 3>
+};
+
+#if defined(BASE_CODEC_X86)
+// NOTE - x86 kernels, each built with the instruction set of its tier in src/base*_<tier>.cpp.
+auto base16_encode_sse41(std::uint8_t const* a_in, std::size_t a_size, char* a_out) -> std::size_t;
+auto base16_decode_sse41(char const* a_in, std::size_t a_size, std::uint8_t* a_out) -> std::size_t;
+auto base16_encode_avx2(std::uint8_t const* a_in, std::size_t a_size, char* a_out) -> std::size_t;
+auto base16_decode_avx2(char const* a_in, std::size_t a_size, std::uint8_t* a_out) -> std::size_t;
+auto base32_encode_avx2(std::uint8_t const* a_in, std::size_t a_size, char* a_out) -> std::size_t;
+auto base32hex_encode_avx2(std::uint8_t const* a_in, std::size_t a_size, char* a_out) -> std::size_t;
+auto base32_decode_avx2(char const* a_in, std::size_t a_size, std::uint8_t* a_out) -> std::size_t;
+auto base32hex_decode_avx2(char const* a_in, std::size_t a_size, std::uint8_t* a_out) -> std::size_t;
+auto base64_encode_avx2(std::uint8_t const* a_in, std::size_t a_size, char* a_out) -> std::size_t;
+auto base64url_encode_avx2(std::uint8_t const* a_in, std::size_t a_size, char* a_out) -> std::size_t;
+auto base64_decode_avx2(char const* a_in, std::size_t a_size, std::uint8_t* a_out) -> std::size_t;
+auto base64url_decode_avx2(char const* a_in, std::size_t a_size, std::uint8_t* a_out) -> std::size_t;
+auto base32_encode_avx512(std::uint8_t const* a_in, std::size_t a_size, char* a_out) -> std::size_t;
+auto base32hex_encode_avx512(std::uint8_t const* a_in, std::size_t a_size, char* a_out) -> std::size_t;
+auto base32_decode_avx512(char const* a_in, std::size_t a_size, std::uint8_t* a_out) -> std::size_t;
+auto base32hex_decode_avx512(char const* a_in, std::size_t a_size, std::uint8_t* a_out) -> std::size_t;
+auto base64_encode_avx512(std::uint8_t const* a_in, std::size_t a_size, char* a_out) -> std::size_t;
+auto base64url_encode_avx512(std::uint8_t const* a_in, std::size_t a_size, char* a_out) -> std::size_t;
+auto base64_decode_avx512(char const* a_in, std::size_t a_size, std::uint8_t* a_out) -> std::size_t;
+auto base64url_decode_avx512(char const* a_in, std::size_t a_size, std::uint8_t* a_out) -> std::size_t;
+
+auto base16_validate_sse41(char const* a_in, std::size_t a_size) -> std::size_t;
+auto base16_validate_avx2(char const* a_in, std::size_t a_size) -> std::size_t;
+auto base32_validate_avx2(char const* a_in, std::size_t a_size) -> std::size_t;
+auto base32hex_validate_avx2(char const* a_in, std::size_t a_size) -> std::size_t;
+auto base64_validate_avx2(char const* a_in, std::size_t a_size) -> std::size_t;
+auto base64url_validate_avx2(char const* a_in, std::size_t a_size) -> std::size_t;
+auto base32_validate_avx512(char const* a_in, std::size_t a_size) -> std::size_t;
+auto base32hex_validate_avx512(char const* a_in, std::size_t a_size) -> std::size_t;
+auto base64_validate_avx512(char const* a_in, std::size_t a_size) -> std::size_t;
+auto base64url_validate_avx512(char const* a_in, std::size_t a_size) -> std::size_t;
+
+auto base16_encode_items_avx2(
+    std::uint8_t const* a_in,
+    std::size_t a_item_size,
+    std::size_t a_items,
+    char* a_out,
+    std::size_t a_stride
+)
+-> std::size_t;
+auto base64_encode_items_avx2(
+    std::uint8_t const* a_in,
+    std::size_t a_item_size,
+    std::size_t a_items,
+    char* a_out,
+    std::size_t a_stride
+)
+-> std::size_t;
+auto base64url_encode_items_avx2(
+    std::uint8_t const* a_in,
+    std::size_t a_item_size,
+    std::size_t a_items,
+    char* a_out,
+    std::size_t a_stride
+)
+-> std::size_t;
+
+inline constexpr kernel_table sse41_kernels {
+    kernel_tier::sse41,
+    &base16_encode_sse41,
+    &base16_decode_sse41,
+    &base16_validate_sse41,
+    &encode_items_each<&base16_encode_sse41, 1>,
+    &base32_encode_scalar,
+    &base32hex_encode_scalar,
+    &base32_decode_scalar,
+    &base32hex_decode_scalar,
+    &base32_validate_scalar,
+    &base32hex_validate_scalar,
+    &base64_encode_scalar,
+    &base64url_encode_scalar,
+    &base64_decode_scalar,
+    &base64url_decode_scalar,
+    &base64_validate_scalar,
+    &base64url_validate_scalar,
+    &encode_items_each<&base64_encode_scalar, 3>,
+    &encode_items_each<&base64url_encode_scalar, 3>
+};
+
+inline constexpr kernel_table avx2_kernels {
+    kernel_tier::avx2,
+    &base16_encode_avx2,
+    &base16_decode_avx2,
+    &base16_validate_avx2,
+    &base16_encode_items_avx2,
+    &base32_encode_avx2,
+    &base32hex_encode_avx2,
+    &base32_decode_avx2,
+    &base32hex_decode_avx2,
+    &base32_validate_avx2,
+    &base32hex_validate_avx2,
+    &base64_encode_avx2,
+    &base64url_encode_avx2,
+    &base64_decode_avx2,
+    &base64url_decode_avx2,
+    &base64_validate_avx2,
+    &base64url_validate_avx2,
+    &base64_encode_items_avx2,
+    &base64url_encode_items_avx2
+};
+
+inline constexpr kernel_table avx512_kernels {
+    kernel_tier::avx512,
+    &base16_encode_avx2,
+    &base16_decode_avx2,
+    &base16_validate_avx2,
+    &base16_encode_items_avx2,
+    &base32_encode_avx512,
+    &base32hex_encode_avx512,
+    &base32_decode_avx512,
+    &base32hex_decode_avx512,
+    &base32_validate_avx512,
+    &base32hex_validate_avx512,
+    &base64_encode_avx512,
+    &base64url_encode_avx512,
+    &base64_decode_avx512,
+    &base64url_decode_avx512,
+    &base64_validate_avx512,
+    &base64url_validate_avx512,
+    &base64_encode_items_avx2,
+    &base64url_encode_items_avx2
+};
+#endif
+
+#if defined(BASE_CODEC_NATIVE)
+// NOTE - With a native build the tier is known at compile time, so the table is a constant and
+//        every call through it resolves to a direct call.
+#if defined(BASE_CODEC_X86) && defined(__AVX512F__) && defined(__AVX512BW__) && \
+    defined(__AVX512VBMI__)
+inline constexpr kernel_table const& native_kernels = avx512_kernels;
+#elif defined(BASE_CODEC_X86) && defined(__AVX2__)
+inline constexpr kernel_table const& native_kernels = avx2_kernels;
+#elif defined(BASE_CODEC_X86) && defined(__SSE4_1__)
+inline constexpr kernel_table const& native_kernels = sse41_kernels;
+#else
+inline constexpr kernel_table const& native_kernels = scalar_kernels;
+#endif
+
+constexpr auto active_kernels() -> kernel_table const&
+{
+    return native_kernels;
+}
+#else
+/**
+ * Returns the kernel table selected for this process, probing the CPU on the first call.
+ */
+auto active_kernels() -> kernel_table const&;
+#endif
+
+}   // namespace detail
+}   // namespace base_codec
+}   // namespace rs
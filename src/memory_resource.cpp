@@ -0,0 +1,135 @@
+#include <base_codec/memory_resource.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <new>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#define BASE_CODEC_HAS_MMAP
+#endif
+
+
+namespace rs
+{
+namespace base_codec
+{
+
+/**
+ * Size (and alignment) of a transparent huge page on x86-64 and most aarch64 kernels.
+ */
+static constexpr std::size_t huge_page_size = std::size_t {2} << 20;
+
+static auto round_to_huge_pages(std::size_t a_bytes) -> std::size_t
+{
+    return (a_bytes + huge_page_size - 1) & ~(huge_page_size - 1);
+}
+
+huge_page_resource::huge_page_resource(
+    std::size_t a_threshold,
+    std::pmr::memory_resource* a_upstream
+)
+    : m_threshold(a_threshold)
+    , m_upstream(a_upstream)
+{
+}
+
+auto huge_page_resource::threshold() const -> std::size_t
+{
+    return m_threshold;
+}
+
+auto huge_page_resource::upstream_resource() const -> std::pmr::memory_resource*
+{
+    return m_upstream;
+}
+
+auto huge_page_resource::do_allocate(
+    std::size_t a_bytes,
+    std::size_t a_alignment
+)
+-> void*
+{
+    auto const block_alignment = std::max(a_alignment, alignment);
+
+#if defined(BASE_CODEC_HAS_MMAP)
+    if (a_bytes > 0 && a_bytes >= m_threshold && block_alignment <= huge_page_size)
+    {
+        auto const size = round_to_huge_pages(a_bytes);
+
+        // NOTE - mmap only guarantees page alignment, so map an extra huge page and trim the
+        //        mapping down to a huge page aligned range the kernel can back with huge pages.
+        auto* const mapping = ::mmap(
+            nullptr,
+            size + huge_page_size,
+            PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS,
+            -1,
+            0
+        );
+
+        if (mapping == MAP_FAILED)
+        {
+            throw std::bad_alloc();
+        }
+
+        auto const address = reinterpret_cast<std::uintptr_t>(mapping);
+        auto const aligned = (address + huge_page_size - 1) & ~(huge_page_size - 1);
+        auto const head = aligned - address;
+        auto const tail = huge_page_size - head;
+
+        if (head > 0)
+        {
+            ::munmap(mapping, head);
+        }
+
+        if (tail > 0)
+        {
+            ::munmap(reinterpret_cast<void*>(aligned + size), tail);
+        }
+
+#if defined(MADV_HUGEPAGE)
+        ::madvise(reinterpret_cast<void*>(aligned), size, MADV_HUGEPAGE);
+#endif
+
+        return reinterpret_cast<void*>(aligned);
+    }
+#endif
+
+    return m_upstream->allocate(a_bytes, block_alignment);
+}
+
+auto huge_page_resource::do_deallocate(
+    void* a_pointer,
+    std::size_t a_bytes,
+    std::size_t a_alignment
+)
+-> void
+{
+    auto const block_alignment = std::max(a_alignment, alignment);
+
+#if defined(BASE_CODEC_HAS_MMAP)
+    if (a_bytes > 0 && a_bytes >= m_threshold && block_alignment <= huge_page_size)
+    {
+        ::munmap(a_pointer, round_to_huge_pages(a_bytes));
+        return;
+    }
+#endif
+
+    m_upstream->deallocate(a_pointer, a_bytes, block_alignment);
+}
+
+auto huge_page_resource::do_is_equal(std::pmr::memory_resource const& a_other) const noexcept
+-> bool
+{
+    return this == &a_other;
+}
+
+auto huge_page_resource_instance() -> huge_page_resource*
+{
+    static huge_page_resource instance;
+    return &instance;
+}
+
+}   // namespace base_codec
+}   // namespace rs
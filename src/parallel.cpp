@@ -0,0 +1,528 @@
+#include <base_codec/parallel.hpp>
+
+#include "codec.hpp"
+#include "kernels.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+
+namespace rs
+{
+namespace base_codec
+{
+
+/**
+ * Chunks are never made smaller than this, so the cost of handing them out stays negligible.
+ */
+static constexpr std::size_t min_chunk_size = std::size_t {256} << 10;
+
+/**
+ * Number of chunks per thread - more than one, so a thread slowed down by the scheduler has its
+ * chunks stolen by the others instead of holding up the whole call.
+ */
+static constexpr std::size_t chunks_per_thread = 4;
+
+/**
+ * Range of task indices owned by one thread. The owner and the thieves take indices from its
+ * front alike, so a steal is a single `fetch_add`.
+ */
+struct alignas(64) task_slice
+{
+    std::atomic<std::size_t> next {0};
+    std::size_t end = 0;
+};
+
+struct thread_pool::state
+{
+    std::size_t concurrency;
+    std::vector<std::thread> threads;
+    std::unique_ptr<task_slice[]> slices;
+
+    // NOTE - Held for the whole of a `bulk_execute`, so calls from different threads take turns.
+    std::mutex call_mutex;
+
+    std::mutex mutex;
+    std::condition_variable start;
+    std::condition_variable done;
+    std::function<void(std::size_t)> const* task = nullptr;
+    std::uint64_t generation = 0;
+    std::size_t running = 0;
+    bool stopping = false;
+
+    /**
+     * Runs the tasks of the thread's own slice, then steals from the slices of the others.
+     */
+    auto run(std::size_t a_self) -> void
+    {
+        for (std::size_t i = 0; i < concurrency; ++i)
+        {
+            auto& slice = slices[(a_self + i) % concurrency];
+
+            for (auto index = slice.next.fetch_add(1, std::memory_order_relaxed);
+                 index < slice.end;
+                 index = slice.next.fetch_add(1, std::memory_order_relaxed))
+            {
+                (*task)(index);
+            }
+        }
+    }
+
+    auto work(std::size_t a_self) -> void
+    {
+        std::uint64_t seen = 0;
+        std::unique_lock lock(mutex);
+
+        while (true)
+        {
+            start.wait(lock, [&] { return stopping || generation != seen; });
+
+            if (stopping)
+            {
+                return;
+            }
+
+            seen = generation;
+            lock.unlock();
+            run(a_self);
+            lock.lock();
+
+            if (--running == 0)
+            {
+                done.notify_one();
+            }
+        }
+    }
+};
+
+thread_pool::thread_pool(std::size_t a_concurrency)
+    : m_state(std::make_unique<state>())
+{
+    if (a_concurrency == 0)
+    {
+        a_concurrency = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    m_state->concurrency = a_concurrency;
+    m_state->slices = std::make_unique<task_slice[]>(a_concurrency);
+    m_state->threads.reserve(a_concurrency - 1);
+
+    for (std::size_t i = 1; i < a_concurrency; ++i)
+    {
+        m_state->threads.emplace_back([this, i] { m_state->work(i); });
+    }
+}
+
+thread_pool::~thread_pool()
+{
+    {
+        std::lock_guard lock(m_state->mutex);
+        m_state->stopping = true;
+    }
+
+    m_state->start.notify_all();
+
+    for (auto& thread : m_state->threads)
+    {
+        thread.join();
+    }
+}
+
+auto thread_pool::do_bulk_execute(
+    std::size_t a_count,
+    std::function<void(std::size_t)> const& a_task
+)
+-> void
+{
+    if (a_count <= 1 || m_state->threads.empty())
+    {
+        for (std::size_t i = 0; i < a_count; ++i)
+        {
+            a_task(i);
+        }
+
+        return;
+    }
+
+    std::lock_guard call_lock(m_state->call_mutex);
+    std::unique_lock lock(m_state->mutex);
+
+    auto const concurrency = m_state->concurrency;
+
+    for (std::size_t i = 0; i < concurrency; ++i)
+    {
+        m_state->slices[i].next.store(a_count * i / concurrency, std::memory_order_relaxed);
+        m_state->slices[i].end = a_count * (i + 1) / concurrency;
+    }
+
+    m_state->task = &a_task;
+    m_state->running = m_state->threads.size();
+    ++m_state->generation;
+    lock.unlock();
+    m_state->start.notify_all();
+
+    m_state->run(0);
+
+    lock.lock();
+    m_state->done.wait(lock, [&] { return m_state->running == 0; });
+    m_state->task = nullptr;
+}
+
+auto thread_pool::do_concurrency() const -> std::size_t
+{
+    return m_state->concurrency;
+}
+
+auto thread_pool_instance() -> thread_pool*
+{
+    static thread_pool instance;
+    return &instance;
+}
+
+/**
+ * Number of chunks to split an input of `a_size` bytes or characters into. Less than 2 means the
+ * input is better off on the calling thread.
+ */
+static auto chunk_count(
+    std::size_t a_size,
+    std::size_t a_concurrency
+)
+-> std::size_t
+{
+    if (a_concurrency <= 1)
+    {
+        return 1;
+    }
+
+    return std::min(a_concurrency * chunks_per_thread, a_size / min_chunk_size);
+}
+
+/**
+ * What the pre-pass found in one chunk of an encoded string.
+ */
+struct chunk_scan
+{
+    /**
+     * Alphabet characters before `stop`.
+     */
+    std::size_t symbols = 0;
+
+    /**
+     * Offset of the first padding character, or in strict mode of the first invalid character.
+     */
+    std::size_t stop = std::string_view::npos;
+
+    bool invalid = false;
+};
+
+/**
+ * Counts the characters of a chunk that decode to bits, using the validate kernel to skip over
+ * runs of them, and finds where the decoding has to stop.
+ */
+template <typename Alphabet, bool Strict>
+static auto scan_chunk(
+    std::string_view const& a_data,
+    std::size_t a_begin,
+    std::size_t a_end,
+    char a_pad_character,
+    detail::validate_kernel a_kernel
+)
+-> chunk_scan
+{
+    chunk_scan ret;
+    auto pos = a_begin;
+
+    while (pos < a_end)
+    {
+        auto const valid = a_kernel(a_data.data() + pos, a_end - pos);
+        ret.symbols += valid;
+        pos += valid;
+
+        if (pos == a_end)
+        {
+            break;
+        }
+
+        if (Alphabet::has_padding && a_data[pos] == a_pad_character)
+        {
+            ret.stop = pos;
+            break;
+        }
+
+        if constexpr (Strict)
+        {
+            ret.stop = pos;
+            ret.invalid = true;
+            break;
+        }
+
+        ++pos;
+    }
+
+    return ret;
+}
+
+template <typename Alphabet, bool Strict>
+static auto decode_parallel_algo(
+    std::string_view const& a_data,
+    std::uint8_t* a_out,
+    std::error_code& a_ec,
+    char a_pad_character,
+    executor& a_target,
+    std::size_t a_chunks
+)
+-> std::size_t
+{
+    using codec = detail::basic_codec<Alphabet, true, Strict>;
+
+    auto const& kernels = detail::active_kernels();
+    auto const validate = detail::alphabet_validate_kernel<Alphabet>(kernels);
+    auto const kernel = detail::alphabet_kernels<Alphabet>(kernels).second;
+    auto const chunk_size = (a_data.size() + a_chunks - 1) / a_chunks;
+    auto const count = (a_data.size() + chunk_size - 1) / chunk_size;
+
+    // NOTE - First pass: the number of symbols in every chunk, and where the decoding stops.
+    std::vector<chunk_scan> scans(count);
+
+    a_target.bulk_execute(
+        count,
+        [&](std::size_t a_index)
+        {
+            scans[a_index] = scan_chunk<Alphabet, Strict>(
+                a_data,
+                a_index * chunk_size,
+                std::min((a_index + 1) * chunk_size, a_data.size()),
+                a_pad_character,
+                validate
+            );
+        }
+    );
+
+    // NOTE - Only the chunks up to the first stop get decoded, so the earliest padding or invalid
+    //        character wins, like it does for the single threaded decoders.
+    std::vector<std::size_t> symbol_offsets(count + 1, 0);
+    std::size_t last = 0;
+
+    for (; last < count; ++last)
+    {
+        symbol_offsets[last + 1] = symbol_offsets[last] + scans[last].symbols;
+
+        if (scans[last].stop != std::string_view::npos)
+        {
+            break;
+        }
+    }
+
+    if (last < count && scans[last].invalid)
+    {
+        a_ec = std::make_error_code(std::errc::invalid_argument);
+        return 0;
+    }
+
+    auto const decoded = last < count ? last + 1 : count;
+
+    // NOTE - Second pass: chunks start anywhere within a byte. A chunk starts with as many zero
+    //        bits as the chunks before it leave over, so its bytes land on their final offsets,
+    //        and the byte it shares with the chunk before it gets merged afterwards.
+    std::vector<detail::decoder_state> states(decoded);
+
+    a_target.bulk_execute(
+        decoded,
+        [&](std::size_t a_index)
+        {
+            auto const begin = a_index * chunk_size;
+            auto const end = scans[a_index].stop != std::string_view::npos
+                ? scans[a_index].stop
+                : std::min(begin + chunk_size, a_data.size());
+            auto const first_bit = symbol_offsets[a_index] * Alphabet::bits;
+            std::error_code ec;
+
+            states[a_index].num_bits = static_cast<std::uint32_t>(first_bit % 8);
+            codec::decode(
+                a_data.substr(begin, end - begin),
+                a_out + first_bit / 8,
+                ec,
+                a_pad_character,
+                kernel,
+                states[a_index]
+            );
+        }
+    );
+
+    std::uint64_t carry = 0;
+    std::uint32_t carry_bits = 0;
+
+    for (std::size_t i = 0; i < decoded; ++i)
+    {
+        auto const first_bit = symbol_offsets[i] * Alphabet::bits;
+        auto const chunk_bits = scans[i].symbols * Alphabet::bits;
+        auto const& state = states[i];
+
+        if (carry_bits + chunk_bits >= 8)
+        {
+            a_out[first_bit / 8] |= static_cast<std::uint8_t>(carry << (8 - carry_bits));
+            carry = state.bit_buffer & ((std::uint64_t {1} << state.num_bits) - 1);
+        } else
+        {
+            carry = (carry << chunk_bits) |
+                    (state.bit_buffer & ((std::uint64_t {1} << chunk_bits) - 1));
+        }
+
+        carry_bits = state.num_bits;
+    }
+
+    return symbol_offsets[decoded] * Alphabet::bits / 8;
+}
+
+template <typename Alphabet>
+auto detail::encode_parallel(
+    std::span<std::uint8_t const> a_data,
+    char* a_out,
+    bool a_padding,
+    char a_pad_character,
+    parallel_options const& a_options
+)
+-> void
+{
+    auto const kernel = alphabet_kernels<Alphabet>(active_kernels()).first;
+    auto* const target = a_options.target != nullptr ? a_options.target : thread_pool_instance();
+    auto const chunks = chunk_count(a_data.size(), target->concurrency());
+
+    if (a_data.size() < a_options.threshold || chunks < 2)
+    {
+        codec_encode<Alphabet>(
+            a_data.data(),
+            a_data.size(),
+            a_out,
+            a_padding,
+            a_pad_character,
+            kernel
+        );
+        return;
+    }
+
+    // NOTE - Every chunk but the last holds whole blocks, so it starts at a known output offset
+    //        and the padding only ever goes to the end of the last one.
+    auto const blocks = (a_data.size() + Alphabet::block_size - 1) / Alphabet::block_size;
+    auto const chunk_size = (blocks + chunks - 1) / chunks * Alphabet::block_size;
+    auto const count = (a_data.size() + chunk_size - 1) / chunk_size;
+
+    target->bulk_execute(
+        count,
+        [&](std::size_t a_index)
+        {
+            auto const begin = a_index * chunk_size;
+            auto const size = std::min(chunk_size, a_data.size() - begin);
+
+            codec_encode<Alphabet>(
+                a_data.data() + begin,
+                size,
+                a_out + begin / Alphabet::block_size * Alphabet::block_symbols,
+                a_padding,
+                a_pad_character,
+                kernel
+            );
+        }
+    );
+}
+
+template <typename Alphabet>
+auto detail::decode_parallel(
+    std::string_view const& a_data,
+    std::uint8_t* a_out,
+    std::error_code& a_ec,
+    bool a_strict,
+    char a_pad_character,
+    parallel_options const& a_options
+)
+-> std::size_t
+{
+    // NOTE - Strict Base16 doesn't accept a dangling digit, like `base16_decode`.
+    if constexpr (!Alphabet::has_padding)
+    {
+        if (a_strict && a_data.size() % Alphabet::block_symbols != 0)
+        {
+            a_ec = std::make_error_code(std::errc::invalid_argument);
+            return 0;
+        }
+    }
+
+    auto* const target = a_options.target != nullptr ? a_options.target : thread_pool_instance();
+    auto const chunks = chunk_count(a_data.size(), target->concurrency());
+
+    // NOTE - A padding character from the alphabet can't be told apart from a symbol by the
+    //        pre-pass, so such inputs are left to the single threaded decoder.
+    bool const pad_is_symbol = Alphabet::has_padding &&
+                               decode_table<Alphabet>[static_cast<unsigned char>(a_pad_character)] !=
+                               invalid_symbol;
+
+    if (a_data.size() < a_options.threshold || chunks < 2 || pad_is_symbol)
+    {
+        decoder_state state;
+        return codec_decode<Alphabet>(
+            a_data,
+            a_out,
+            a_ec,
+            a_strict,
+            a_pad_character,
+            alphabet_kernels<Alphabet>(active_kernels()).second,
+            state
+        );
+    }
+
+    if (a_strict)
+    {
+        return decode_parallel_algo<Alphabet, true>(
+            a_data,
+            a_out,
+            a_ec,
+            a_pad_character,
+            *target,
+            chunks
+        );
+    }
+
+    return decode_parallel_algo<Alphabet, false>(
+        a_data,
+        a_out,
+        a_ec,
+        a_pad_character,
+        *target,
+        chunks
+    );
+}
+
+#define BASE_CODEC_INSTANTIATE_PARALLEL(ALPHABET) \
+    template auto detail::encode_parallel<ALPHABET>( \
+        std::span<std::uint8_t const>, \
+        char*, \
+        bool, \
+        char, \
+        parallel_options const& \
+    ) \
+    -> void; \
+    template auto detail::decode_parallel<ALPHABET>( \
+        std::string_view const&, \
+        std::uint8_t*, \
+        std::error_code&, \
+        bool, \
+        char, \
+        parallel_options const& \
+    ) \
+    -> std::size_t;
+
+BASE_CODEC_INSTANTIATE_PARALLEL(base16_alphabet)
+BASE_CODEC_INSTANTIATE_PARALLEL(base32_alphabet)
+BASE_CODEC_INSTANTIATE_PARALLEL(base32hex_alphabet)
+BASE_CODEC_INSTANTIATE_PARALLEL(base64_alphabet)
+BASE_CODEC_INSTANTIATE_PARALLEL(base64url_alphabet)
+
+#undef BASE_CODEC_INSTANTIATE_PARALLEL
+
+}   // namespace base_codec
+}   // namespace rs
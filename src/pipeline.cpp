@@ -0,0 +1,1009 @@
+#include <base_codec/pipeline.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define BASE_CODEC_HAS_POSIX_IO
+#endif
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter) && \
+    defined(__NR_io_uring_register)
+#define BASE_CODEC_HAS_IO_URING
+#endif
+#endif
+
+
+namespace rs
+{
+namespace base_codec
+{
+
+/**
+ * Initial room for the output of a whole block, enough for every codec of the library - Base16
+ * encoding doubles its input, and the partial block an encoder carries over adds at most one more
+ * block. Transcoders needing more get the buffers grown on their first run.
+ */
+static auto output_capacity(std::size_t a_block_size) -> std::size_t
+{
+    return a_block_size * 2 + 16;
+}
+
+static auto errno_code() -> std::error_code
+{
+    return std::error_code(errno, std::generic_category());
+}
+
+/**
+ * Input and output buffers of one block in flight.
+ */
+struct pipeline_buffer
+{
+    std::unique_ptr<std::uint8_t[]> in;
+    std::unique_ptr<std::uint8_t[]> out;
+};
+
+#if defined(BASE_CODEC_HAS_IO_URING)
+/**
+ * Minimal io_uring instance on top of the raw system calls, with the pipeline buffers registered
+ * when the memory lock limit allows it.
+ */
+class io_ring
+{
+public:
+    /**
+     * Returns null if the kernel has no (usable) io_uring - older than 5.6, or disabled.
+     */
+    static auto create(
+        unsigned a_entries,
+        std::vector<iovec> const& a_buffers
+    )
+    -> std::unique_ptr<io_ring>
+    {
+        io_uring_params params {};
+        auto const fd = static_cast<int>(::syscall(__NR_io_uring_setup, a_entries, &params));
+
+        if (fd < 0)
+        {
+            return nullptr;
+        }
+
+        std::unique_ptr<io_ring> ret(new io_ring(fd));
+
+        // NOTE - Offset -1 (the current file position) is needed for pipes and sockets.
+        if (!(params.features & IORING_FEAT_RW_CUR_POS) || !ret->map(params))
+        {
+            return nullptr;
+        }
+
+        ret->m_fixed = ::syscall(
+            __NR_io_uring_register,
+            fd,
+            IORING_REGISTER_BUFFERS,
+            a_buffers.data(),
+            static_cast<unsigned>(a_buffers.size())
+        ) == 0;
+
+        return ret;
+    }
+
+    io_ring(io_ring const&) = delete;
+    auto operator=(io_ring const&) -> io_ring& = delete;
+
+    ~io_ring()
+    {
+        if (m_sqes != nullptr)
+        {
+            ::munmap(m_sqes, m_sqes_size);
+        }
+
+        if (m_cq_ring != nullptr && m_cq_ring != m_sq_ring)
+        {
+            ::munmap(m_cq_ring, m_cq_ring_size);
+        }
+
+        if (m_sq_ring != nullptr)
+        {
+            ::munmap(m_sq_ring, m_sq_ring_size);
+        }
+
+        ::close(m_fd);
+    }
+
+    /**
+     * Queues a read or write of `a_size` bytes at `a_data`, which lies in registered buffer
+     * `a_buffer`. An offset of -1 reads or writes at the current file position.
+     */
+    auto queue(
+        bool a_write,
+        int a_fd,
+        std::uint8_t* a_data,
+        std::size_t a_size,
+        std::uint64_t a_offset,
+        unsigned a_buffer,
+        std::uint64_t a_user_data
+    )
+    -> void
+    {
+        auto const tail = *m_sq_tail;
+        auto const index = tail & *m_sq_mask;
+        auto& sqe = m_sqes[index];
+
+        std::memset(&sqe, 0, sizeof(sqe));
+
+        if (m_fixed)
+        {
+            sqe.opcode = a_write ? IORING_OP_WRITE_FIXED : IORING_OP_READ_FIXED;
+            sqe.buf_index = static_cast<std::uint16_t>(a_buffer);
+        } else
+        {
+            sqe.opcode = a_write ? IORING_OP_WRITE : IORING_OP_READ;
+        }
+
+        sqe.fd = a_fd;
+        sqe.addr = reinterpret_cast<std::uint64_t>(a_data);
+        sqe.len = static_cast<std::uint32_t>(a_size);
+        sqe.off = a_offset;
+        sqe.user_data = a_user_data;
+
+        m_sq_array[index] = index;
+        std::atomic_ref(*m_sq_tail).store(tail + 1, std::memory_order_release);
+        ++m_pending;
+    }
+
+    /**
+     * Submits the queued operations without waiting for any of them.
+     */
+    auto submit() -> std::error_code
+    {
+        return m_pending == 0 ? std::error_code {} : enter(0);
+    }
+
+    /**
+     * Submits the queued operations and waits for at least one completion.
+     */
+    auto submit_and_wait() -> std::error_code
+    {
+        return enter(1);
+    }
+
+    /**
+     * Calls `a_handler(user_data, result)` for every completion that has arrived.
+     */
+    template <typename Handler>
+    auto reap(Handler&& a_handler) -> void
+    {
+        auto head = *m_cq_head;
+
+        while (head != std::atomic_ref(*m_cq_tail).load(std::memory_order_acquire))
+        {
+            auto const& cqe = m_cqes[head & *m_cq_mask];
+            auto const user_data = cqe.user_data;
+            auto const result = cqe.res;
+
+            std::atomic_ref(*m_cq_head).store(++head, std::memory_order_release);
+            a_handler(user_data, result);
+        }
+    }
+
+private:
+    explicit io_ring(int a_fd)
+        : m_fd(a_fd)
+    {
+    }
+
+    auto enter(unsigned a_min_complete) -> std::error_code
+    {
+        while (true)
+        {
+            auto const submitted = ::syscall(
+                __NR_io_uring_enter,
+                m_fd,
+                m_pending,
+                a_min_complete,
+                a_min_complete > 0 ? IORING_ENTER_GETEVENTS : 0u,
+                nullptr,
+                0
+            );
+
+            if (submitted >= 0)
+            {
+                m_pending -= static_cast<unsigned>(submitted);
+                return {};
+            }
+
+            if (errno != EINTR)
+            {
+                return errno_code();
+            }
+        }
+    }
+
+    auto map(io_uring_params const& a_params) -> bool
+    {
+        m_sq_ring_size = a_params.sq_off.array + a_params.sq_entries * sizeof(unsigned);
+        m_cq_ring_size = a_params.cq_off.cqes + a_params.cq_entries * sizeof(io_uring_cqe);
+
+        bool const single = a_params.features & IORING_FEAT_SINGLE_MMAP;
+
+        if (single)
+        {
+            m_sq_ring_size = m_cq_ring_size = std::max(m_sq_ring_size, m_cq_ring_size);
+        }
+
+        m_sq_ring = map_region(m_sq_ring_size, IORING_OFF_SQ_RING);
+        m_cq_ring = single ? m_sq_ring : map_region(m_cq_ring_size, IORING_OFF_CQ_RING);
+        m_sqes_size = a_params.sq_entries * sizeof(io_uring_sqe);
+        m_sqes = static_cast<io_uring_sqe*>(map_region(m_sqes_size, IORING_OFF_SQES));
+
+        if (m_sq_ring == nullptr || m_cq_ring == nullptr || m_sqes == nullptr)
+        {
+            return false;
+        }
+
+        auto* const sq = static_cast<char*>(m_sq_ring);
+        auto* const cq = static_cast<char*>(m_cq_ring);
+
+        m_sq_tail = reinterpret_cast<unsigned*>(sq + a_params.sq_off.tail);
+        m_sq_mask = reinterpret_cast<unsigned*>(sq + a_params.sq_off.ring_mask);
+        m_sq_array = reinterpret_cast<unsigned*>(sq + a_params.sq_off.array);
+        m_cq_head = reinterpret_cast<unsigned*>(cq + a_params.cq_off.head);
+        m_cq_tail = reinterpret_cast<unsigned*>(cq + a_params.cq_off.tail);
+        m_cq_mask = reinterpret_cast<unsigned*>(cq + a_params.cq_off.ring_mask);
+        m_cqes = reinterpret_cast<io_uring_cqe*>(cq + a_params.cq_off.cqes);
+
+        return true;
+    }
+
+    auto map_region(
+        std::size_t a_size,
+        off_t a_offset
+    )
+    -> void*
+    {
+        auto* const region = ::mmap(
+            nullptr,
+            a_size,
+            PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE,
+            m_fd,
+            a_offset
+        );
+
+        return region == MAP_FAILED ? nullptr : region;
+    }
+
+    int m_fd;
+    bool m_fixed = false;
+    unsigned m_pending = 0;
+
+    void* m_sq_ring = nullptr;
+    void* m_cq_ring = nullptr;
+    io_uring_sqe* m_sqes = nullptr;
+    std::size_t m_sq_ring_size = 0;
+    std::size_t m_cq_ring_size = 0;
+    std::size_t m_sqes_size = 0;
+
+    unsigned* m_sq_tail = nullptr;
+    unsigned* m_sq_mask = nullptr;
+    unsigned* m_sq_array = nullptr;
+    unsigned* m_cq_head = nullptr;
+    unsigned* m_cq_tail = nullptr;
+    unsigned* m_cq_mask = nullptr;
+    io_uring_cqe* m_cqes = nullptr;
+};
+#endif
+
+struct file_pipeline::state
+{
+    pipeline_options options;
+    std::vector<pipeline_buffer> buffers;
+    std::size_t capacity = 0;
+
+#if defined(BASE_CODEC_HAS_IO_URING)
+    std::unique_ptr<io_ring> ring;
+#endif
+
+    /**
+     * (Re)allocates the output buffers with room for `a_capacity` bytes each, registering them
+     * with a new io_uring instance if one is used.
+     */
+    auto allocate(std::size_t a_capacity) -> void;
+};
+
+#if defined(BASE_CODEC_HAS_POSIX_IO)
+static auto is_regular(int a_fd) -> bool
+{
+    struct stat file_stat {};
+    return ::fstat(a_fd, &file_stat) == 0 && S_ISREG(file_stat.st_mode);
+}
+
+/**
+ * Writes a whole buffer at the current file position.
+ */
+static auto write_all(
+    int a_fd,
+    std::uint8_t const* a_data,
+    std::size_t a_size
+)
+-> std::error_code
+{
+    while (a_size > 0)
+    {
+        auto const written = ::write(a_fd, a_data, a_size);
+
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            return errno_code();
+        }
+
+        a_data += written;
+        a_size -= static_cast<std::size_t>(written);
+    }
+
+    return {};
+}
+
+/**
+ * Reads until the buffer is full or the input ends, and returns the number of bytes read.
+ */
+static auto read_full(
+    int a_fd,
+    std::uint8_t* a_data,
+    std::size_t a_size,
+    std::error_code& a_ec
+)
+-> std::size_t
+{
+    std::size_t filled = 0;
+
+    while (filled < a_size)
+    {
+        auto const read = ::read(a_fd, a_data + filled, a_size - filled);
+
+        if (read < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            a_ec = errno_code();
+            break;
+        }
+
+        if (read == 0)
+        {
+            break;
+        }
+
+        filled += static_cast<std::size_t>(read);
+    }
+
+    return filled;
+}
+
+/**
+ * Queue of buffer indices handed between the threads of the fallback pipeline.
+ */
+class buffer_queue
+{
+public:
+    auto push(std::size_t a_index) -> void
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            m_items.push_back(a_index);
+        }
+
+        m_ready.notify_one();
+    }
+
+    /**
+     * Waits for the next index, or returns nothing once the queue is closed and drained.
+     */
+    auto pop() -> std::optional<std::size_t>
+    {
+        std::unique_lock lock(m_mutex);
+        m_ready.wait(lock, [&] { return !m_items.empty() || m_closed; });
+
+        if (m_items.empty())
+        {
+            return std::nullopt;
+        }
+
+        auto const ret = m_items.front();
+        m_items.pop_front();
+        return ret;
+    }
+
+    auto close() -> void
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            m_closed = true;
+        }
+
+        m_ready.notify_all();
+    }
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_ready;
+    std::deque<std::size_t> m_items;
+    bool m_closed = false;
+};
+
+/**
+ * Fallback pipeline: a reader thread fills free buffers, the calling thread transcodes them in
+ * order and a writer thread writes them out and hands them back to the reader.
+ */
+static auto run_threads(
+    int a_in,
+    int a_out,
+    detail::transcode_step const& a_step,
+    std::vector<pipeline_buffer>& a_buffers,
+    std::size_t a_block_size,
+    std::size_t a_capacity,
+    std::error_code& a_ec
+)
+-> std::uint64_t
+{
+    auto const capacity = a_capacity;
+    std::vector<std::size_t> filled(a_buffers.size(), 0);
+    std::vector<std::size_t> produced(a_buffers.size(), 0);
+
+    buffer_queue free_buffers;
+    buffer_queue read_buffers;
+    buffer_queue written_buffers;
+    std::error_code read_ec;
+    std::error_code write_ec;
+    std::atomic<bool> write_failed {false};
+    std::atomic<std::uint64_t> total {0};
+
+    for (std::size_t i = 0; i < a_buffers.size(); ++i)
+    {
+        free_buffers.push(i);
+    }
+
+    std::thread reader([&]
+    {
+        while (auto const index = free_buffers.pop())
+        {
+            filled[*index] = read_full(a_in, a_buffers[*index].in.get(), a_block_size, read_ec);
+
+            // NOTE - An empty buffer marks the end of the input, or a read error - whatever a
+            //        failed read got before the error is dropped, and reading stops there.
+            if (read_ec)
+            {
+                filled[*index] = 0;
+            }
+
+            read_buffers.push(*index);
+
+            if (filled[*index] == 0)
+            {
+                break;
+            }
+        }
+    });
+
+    std::thread writer([&]
+    {
+        while (auto const index = written_buffers.pop())
+        {
+            if (!write_failed)
+            {
+                write_ec = write_all(a_out, a_buffers[*index].out.get(), produced[*index]);
+                write_failed = static_cast<bool>(write_ec);
+                total += write_failed ? 0 : produced[*index];
+            }
+
+            free_buffers.push(*index);
+        }
+    });
+
+    std::error_code ec;
+
+    while (auto const index = read_buffers.pop())
+    {
+        if (filled[*index] == 0 || write_failed)
+        {
+            break;
+        }
+
+        produced[*index] = a_step.update(
+            std::span<std::uint8_t const>(a_buffers[*index].in.get(), filled[*index]),
+            std::span<std::uint8_t>(a_buffers[*index].out.get(), capacity),
+            ec
+        );
+
+        if (ec)
+        {
+            break;
+        }
+
+        written_buffers.push(*index);
+    }
+
+    written_buffers.close();
+    writer.join();
+    free_buffers.close();
+    reader.join();
+
+    ec = ec ? ec : read_ec ? read_ec : write_ec;
+
+    if (!ec)
+    {
+        auto const size = a_step.finish(
+            std::span<std::uint8_t>(a_buffers.front().out.get(), capacity),
+            ec
+        );
+
+        if (!ec)
+        {
+            ec = write_all(a_out, a_buffers.front().out.get(), size);
+            total += ec ? 0 : size;
+        }
+    }
+
+    if (ec)
+    {
+        a_ec = ec;
+    }
+
+    return total;
+}
+#endif
+
+#if defined(BASE_CODEC_HAS_IO_URING)
+/**
+ * Progress of the block held by one buffer.
+ */
+struct block_slot
+{
+    enum class stage
+    {
+        free,
+        reading,
+        ready,
+        writing
+    };
+
+    stage current = stage::free;
+    std::uint64_t block = 0;
+    std::uint64_t in_offset = 0;
+    std::uint64_t out_offset = 0;
+    std::size_t filled = 0;
+    std::size_t produced = 0;
+    std::size_t written = 0;
+};
+
+/**
+ * io_uring pipeline. Every buffer has at most one read or write in flight, so up to `buffers`
+ * blocks are being read or written while the calling thread transcodes the next one in order.
+ * Regular files are accessed at explicit offsets, so their reads and writes run concurrently;
+ * other files at their current position, one read and one write at a time.
+ */
+static auto run_io_uring(
+    io_ring& a_ring,
+    int a_in,
+    int a_out,
+    detail::transcode_step const& a_step,
+    std::vector<pipeline_buffer>& a_buffers,
+    std::size_t a_block_size,
+    std::size_t a_capacity,
+    std::error_code& a_ec
+)
+-> std::uint64_t
+{
+    static constexpr auto current_position = ~std::uint64_t {0};
+
+    auto const capacity = a_capacity;
+    bool const in_seekable = is_regular(a_in);
+    bool const out_seekable = is_regular(a_out);
+    auto const in_base = in_seekable ? ::lseek(a_in, 0, SEEK_CUR) : 0;
+    auto const out_base = out_seekable ? ::lseek(a_out, 0, SEEK_CUR) : 0;
+
+    std::vector<block_slot> slots(a_buffers.size());
+    std::deque<std::size_t> write_queue;
+    std::uint64_t next_read = 0;
+    std::uint64_t next_transcode = 0;
+    std::uint64_t in_offset = static_cast<std::uint64_t>(in_base);
+    std::uint64_t out_offset = static_cast<std::uint64_t>(out_base);
+    std::uint64_t consumed = 0;
+    std::uint64_t total = 0;
+    std::size_t reads = 0;
+    std::size_t writes = 0;
+    bool end_of_input = false;
+    std::error_code ec;
+
+    // NOTE - Buffer i is registered as in buffer 2 * i and out buffer 2 * i + 1, and the low bit
+    //        of the user data tells writes from reads.
+    auto const queue_read = [&](std::size_t a_index)
+    {
+        auto& slot = slots[a_index];
+        a_ring.queue(
+            false,
+            a_in,
+            a_buffers[a_index].in.get() + slot.filled,
+            a_block_size - slot.filled,
+            in_seekable ? slot.in_offset + slot.filled : current_position,
+            static_cast<unsigned>(2 * a_index),
+            2 * a_index
+        );
+        ++reads;
+    };
+
+    auto const queue_write = [&](std::size_t a_index)
+    {
+        auto& slot = slots[a_index];
+        a_ring.queue(
+            true,
+            a_out,
+            a_buffers[a_index].out.get() + slot.written,
+            slot.produced - slot.written,
+            out_seekable ? slot.out_offset + slot.written : current_position,
+            static_cast<unsigned>(2 * a_index + 1),
+            2 * a_index + 1
+        );
+        ++writes;
+    };
+
+    auto const complete = [&](std::uint64_t a_user_data, int a_result)
+    {
+        auto const index = static_cast<std::size_t>(a_user_data / 2);
+        auto& slot = slots[index];
+        bool const write = a_user_data & 1;
+        bool const retry = a_result == -EINTR || a_result == -EAGAIN;
+
+        write ? --writes : --reads;
+
+        if (a_result < 0 && !retry)
+        {
+            ec = ec ? ec : std::error_code(-a_result, std::generic_category());
+        }
+
+        if (ec)
+        {
+            slot.current = block_slot::stage::free;
+            return;
+        }
+
+        if (write)
+        {
+            slot.written += static_cast<std::size_t>(std::max(a_result, 0));
+
+            if (slot.written < slot.produced)
+            {
+                queue_write(index);
+                return;
+            }
+
+            total += slot.produced;
+            slot.current = block_slot::stage::free;
+            return;
+        }
+
+        if (a_result == 0)
+        {
+            end_of_input = true;
+        }
+
+        slot.filled += static_cast<std::size_t>(std::max(a_result, 0));
+
+        // NOTE - A short read of a regular file only means the end of it once a read returns 0,
+        //        everything in between has to land in the same block.
+        if (retry || (in_seekable && a_result > 0 && slot.filled < a_block_size))
+        {
+            queue_read(index);
+            return;
+        }
+
+        slot.current = block_slot::stage::ready;
+    };
+
+    while (true)
+    {
+        if (!ec)
+        {
+            for (std::size_t i = 0; i < slots.size() && !end_of_input; ++i)
+            {
+                if (slots[i].current != block_slot::stage::free || (!in_seekable && reads > 0))
+                {
+                    continue;
+                }
+
+                slots[i] = block_slot {
+                    block_slot::stage::reading,
+                    next_read++,
+                    in_offset,
+                    0,
+                    0,
+                    0,
+                    0
+                };
+                in_offset += a_block_size;
+                queue_read(i);
+            }
+
+            // NOTE - The reads go to the kernel before transcoding, so it works on them meanwhile.
+            if (auto const enter_ec = a_ring.submit())
+            {
+                a_ec = enter_ec;
+                return total;
+            }
+
+            // NOTE - Transcoding runs in block order, while the kernel works on the other blocks.
+            for (bool progress = true; progress && !ec;)
+            {
+                progress = false;
+
+                for (std::size_t i = 0; i < slots.size(); ++i)
+                {
+                    auto& slot = slots[i];
+
+                    if (slot.current != block_slot::stage::ready || slot.block != next_transcode)
+                    {
+                        continue;
+                    }
+
+                    slot.produced = a_step.update(
+                        std::span<std::uint8_t const>(a_buffers[i].in.get(), slot.filled),
+                        std::span<std::uint8_t>(a_buffers[i].out.get(), capacity),
+                        ec
+                    );
+                    consumed += slot.filled;
+                    slot.out_offset = out_offset;
+                    out_offset += slot.produced;
+                    ++next_transcode;
+                    progress = true;
+
+                    if (slot.produced > 0)
+                    {
+                        slot.current = block_slot::stage::writing;
+                        write_queue.push_back(i);
+                    } else
+                    {
+                        slot.current = block_slot::stage::free;
+                    }
+                }
+            }
+
+            while (!ec && !write_queue.empty() && (out_seekable || writes == 0))
+            {
+                queue_write(write_queue.front());
+                write_queue.pop_front();
+            }
+        }
+
+        bool const done = ec ? true : end_of_input && next_transcode == next_read &&
+                                      write_queue.empty();
+
+        if (done && reads == 0 && writes == 0)
+        {
+            break;
+        }
+
+        if (auto const enter_ec = a_ring.submit_and_wait())
+        {
+            a_ec = enter_ec;
+            return total;
+        }
+
+        a_ring.reap(complete);
+    }
+
+    if (!ec)
+    {
+        auto const size = a_step.finish(
+            std::span<std::uint8_t>(a_buffers.front().out.get(), capacity),
+            ec
+        );
+
+        if (!ec && size > 0)
+        {
+            if (out_seekable)
+            {
+                ::lseek(a_out, static_cast<off_t>(out_offset), SEEK_SET);
+            }
+
+            ec = write_all(a_out, a_buffers.front().out.get(), size);
+            out_offset += size;
+            total += ec ? 0 : size;
+        }
+    }
+
+    // NOTE - Leave both files positioned after what was transcoded, like the threads do.
+    if (in_seekable)
+    {
+        ::lseek(a_in, static_cast<off_t>(in_base) + static_cast<off_t>(consumed), SEEK_SET);
+    }
+
+    if (out_seekable)
+    {
+        ::lseek(a_out, static_cast<off_t>(out_offset), SEEK_SET);
+    }
+
+    if (ec)
+    {
+        a_ec = ec;
+    }
+
+    return total;
+}
+#endif
+
+file_pipeline::file_pipeline(pipeline_options const& a_options)
+    : m_state(std::make_unique<state>())
+{
+    auto& options = m_state->options;
+    options = a_options;
+    options.block_size = std::clamp<std::size_t>(options.block_size, 4096, std::size_t {1} << 30);
+    options.buffers = std::max<std::size_t>(options.buffers, 1);
+
+    m_state->buffers.resize(options.buffers);
+
+    for (auto& buffer : m_state->buffers)
+    {
+        buffer.in = std::make_unique<std::uint8_t[]>(options.block_size);
+    }
+
+    m_state->allocate(output_capacity(options.block_size));
+}
+
+auto file_pipeline::state::allocate(std::size_t a_capacity) -> void
+{
+    capacity = a_capacity;
+
+    for (auto& buffer : buffers)
+    {
+        buffer.out = std::make_unique<std::uint8_t[]>(capacity);
+    }
+
+#if defined(BASE_CODEC_HAS_IO_URING)
+    ring.reset();
+
+    if (options.io_uring)
+    {
+        std::vector<iovec> registered;
+
+        for (auto& buffer : buffers)
+        {
+            registered.push_back({buffer.in.get(), options.block_size});
+            registered.push_back({buffer.out.get(), capacity});
+        }
+
+        ring = io_ring::create(
+            std::max(options.queue_depth, static_cast<unsigned>(options.buffers)),
+            registered
+        );
+    }
+#endif
+}
+
+file_pipeline::~file_pipeline() = default;
+
+auto file_pipeline::uses_io_uring() const -> bool
+{
+#if defined(BASE_CODEC_HAS_IO_URING)
+    return m_state->ring != nullptr;
+#else
+    return false;
+#endif
+}
+
+auto file_pipeline::run(
+    int a_in,
+    int a_out,
+    detail::transcode_step const& a_step,
+    std::error_code& a_ec
+)
+-> std::uint64_t
+{
+    // NOTE - The buffers only ever grow, for transcoders expanding their input more than the
+    //        codecs of the library do.
+    auto const needed = a_step.max_update_size(m_state->options.block_size);
+
+    if (needed > m_state->capacity)
+    {
+        m_state->allocate(needed);
+    }
+
+#if defined(BASE_CODEC_HAS_IO_URING)
+    if (m_state->ring)
+    {
+        return run_io_uring(
+            *m_state->ring,
+            a_in,
+            a_out,
+            a_step,
+            m_state->buffers,
+            m_state->options.block_size,
+            m_state->capacity,
+            a_ec
+        );
+    }
+#endif
+
+#if defined(BASE_CODEC_HAS_POSIX_IO)
+    return run_threads(
+        a_in,
+        a_out,
+        a_step,
+        m_state->buffers,
+        m_state->options.block_size,
+        m_state->capacity,
+        a_ec
+    );
+#else
+    a_ec = std::make_error_code(std::errc::function_not_supported);
+    return 0;
+#endif
+}
+
+auto file_pipeline::run(
+    std::filesystem::path const& a_in,
+    std::filesystem::path const& a_out,
+    detail::transcode_step const& a_step,
+    std::error_code& a_ec
+)
+-> std::uint64_t
+{
+#if defined(BASE_CODEC_HAS_POSIX_IO)
+    auto const in = ::open(a_in.c_str(), O_RDONLY | O_CLOEXEC);
+
+    if (in < 0)
+    {
+        a_ec = errno_code();
+        return 0;
+    }
+
+    auto const out = ::open(a_out.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+
+    if (out < 0)
+    {
+        a_ec = errno_code();
+        ::close(in);
+        return 0;
+    }
+
+    auto const ret = run(in, out, a_step, a_ec);
+
+    ::close(in);
+
+    if (::close(out) != 0 && !a_ec)
+    {
+        a_ec = errno_code();
+    }
+
+    return ret;
+#else
+    a_ec = std::make_error_code(std::errc::function_not_supported);
+    return 0;
+#endif
+}
+
+}   // namespace base_codec
+}   // namespace rs
@@ -0,0 +1,72 @@
+/**
+ * @file streaming.hpp
+ *
+ * Helper behind the streaming encoders, which carry partial blocks across chunk boundaries.
+ */
+#pragma once
+
+#include <base_codec/stream.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+
+namespace rs
+{
+namespace base_codec
+{
+namespace detail
+{
+
+/**
+ * Encodes every whole block that can be made out of the held back bytes and the new chunk, and
+ * holds back the bytes of the partial block left at its end.
+ *
+ * `a_encode` is called as `a_encode(std::uint8_t const* a_in, std::size_t a_size, char* a_out)`
+ * with whole blocks only, and returns the number of characters written.
+ */
+template <std::size_t BlockSize, typename Encoder>
+auto encode_update(
+    encoder_state& a_state,
+    std::span<std::uint8_t const> a_data,
+    char* a_out,
+    Encoder&& a_encode
+)
+-> std::size_t
+{
+    std::size_t written = 0;
+
+    if (a_state.carry_size > 0)
+    {
+        auto const needed = std::min(BlockSize - a_state.carry_size, a_data.size());
+        std::copy_n(a_data.begin(), needed, a_state.carry.begin() + a_state.carry_size);
+        a_state.carry_size += needed;
+        a_data = a_data.subspan(needed);
+
+        if (a_state.carry_size < BlockSize)
+        {
+            return 0;
+        }
+
+        written += a_encode(a_state.carry.data(), BlockSize, a_out);
+        a_state.carry_size = 0;
+    }
+
+    auto const whole = a_data.size() - a_data.size() % BlockSize;
+
+    if (whole > 0)
+    {
+        written += a_encode(a_data.data(), whole, a_out + written);
+    }
+
+    std::copy(a_data.begin() + whole, a_data.end(), a_state.carry.begin());
+    a_state.carry_size = a_data.size() - whole;
+
+    return written;
+}
+
+}   // namespace detail
+}   // namespace base_codec
+}   // namespace rs
@@ -0,0 +1,149 @@
+/**
+ * @file swar.hpp
+ *
+ * Helpers for the portable scalar kernels, which work on whole blocks held in 64-bit words and
+ * on lookup tables generated from the alphabets at compile time.
+ */
+#pragma once
+
+#include <base_codec/alphabet.hpp>
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+
+namespace rs
+{
+namespace base_codec
+{
+namespace detail
+{
+
+/**
+ * Loads `Size` bytes as a big endian number.
+ */
+template <std::size_t Size>
+inline auto load_be(std::uint8_t const* a_in) -> std::uint64_t
+{
+    std::uint64_t ret = 0;
+
+    for (std::size_t i = 0; i < Size; ++i)
+    {
+        ret = (ret << 8) | a_in[i];
+    }
+
+    return ret;
+}
+
+/**
+ * Stores the low `Size` bytes of a number in big endian order.
+ */
+template <std::size_t Size>
+inline auto store_be(std::uint8_t* a_out, std::uint64_t a_value) -> void
+{
+    for (std::size_t i = 0; i < Size; ++i)
+    {
+        a_out[i] = static_cast<std::uint8_t>(a_value >> ((Size - 1 - i) * 8));
+    }
+}
+
+/**
+ * Writes four 2 character pairs from a pair table with a single 8 byte store.
+ */
+inline auto store_pairs(
+    char* a_out,
+    char const* a_pairs,
+    std::size_t a_first,
+    std::size_t a_second,
+    std::size_t a_third,
+    std::size_t a_fourth
+)
+-> void
+{
+    std::uint16_t pairs[4];
+    std::memcpy(&pairs[0], a_pairs + a_first * 2, 2);
+    std::memcpy(&pairs[1], a_pairs + a_second * 2, 2);
+    std::memcpy(&pairs[2], a_pairs + a_third * 2, 2);
+    std::memcpy(&pairs[3], a_pairs + a_fourth * 2, 2);
+
+    std::uint64_t word = 0;
+
+    if constexpr (std::endian::native == std::endian::little)
+    {
+        word = pairs[0] |
+               (static_cast<std::uint64_t>(pairs[1]) << 16) |
+               (static_cast<std::uint64_t>(pairs[2]) << 32) |
+               (static_cast<std::uint64_t>(pairs[3]) << 48);
+    } else
+    {
+        word = (static_cast<std::uint64_t>(pairs[0]) << 48) |
+               (static_cast<std::uint64_t>(pairs[1]) << 32) |
+               (static_cast<std::uint64_t>(pairs[2]) << 16) |
+               pairs[3];
+    }
+
+    std::memcpy(a_out, &word, 8);
+}
+
+/**
+ * Builds a table mapping every `2 * Bits` wide index to its two symbols, so one lookup encodes
+ * two symbols at once (4096 entries for Base64, 1024 for Base32 and 256 for Base16).
+ */
+template <std::size_t Bits>
+constexpr auto make_pair_table(std::string_view a_alphabet) -> std::array<char, (2 << (2 * Bits))>
+{
+    std::array<char, (2 << (2 * Bits))> ret {};
+
+    for (std::size_t i = 0; i < (std::size_t {1} << (2 * Bits)); ++i)
+    {
+        ret[i * 2] = a_alphabet[i >> Bits];
+        ret[i * 2 + 1] = a_alphabet[i & ((std::size_t {1} << Bits) - 1)];
+    }
+
+    return ret;
+}
+
+/**
+ * Returns the length of the longest prefix of characters that are part of the alphabet behind
+ * the given decode table. Eight characters get checked per step with a single test.
+ */
+inline auto valid_prefix(
+    char const* a_in,
+    std::size_t a_size,
+    std::array<std::uint8_t, 256> const& a_decode_values
+)
+-> std::size_t
+{
+    auto const* symbols = reinterpret_cast<unsigned char const*>(a_in);
+    std::size_t consumed = 0;
+
+    for (; consumed + 8 <= a_size; consumed += 8)
+    {
+        std::uint32_t errors = 0;
+
+        for (std::size_t i = 0; i < 8; ++i)
+        {
+            errors |= a_decode_values[symbols[consumed + i]];
+        }
+
+        if (errors & 0x80)
+        {
+            break;
+        }
+    }
+
+    while (consumed < a_size && a_decode_values[symbols[consumed]] != invalid_symbol)
+    {
+        ++consumed;
+    }
+
+    return consumed;
+}
+
+}   // namespace detail
+}   // namespace base_codec
+}   // namespace rs
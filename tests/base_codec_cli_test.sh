@@ -0,0 +1,78 @@
+#!/bin/sh
+# Checks the line handling of the base_codec command line tool, over both the memory mapped path
+# (a file argument) and the streaming path (standard input).
+#
+# Usage: base_codec_cli_test.sh path/to/base_codec
+
+set -u
+
+cli="$1"
+work="$(mktemp -d)"
+trap 'rm -rf "$work"' EXIT
+failures=0
+
+fail()
+{
+    echo "FAILED: $1" >&2
+    failures=$((failures + 1))
+}
+
+# expect NAME EXPECTED INPUT ARGS... - runs the tool on INPUT from a file and from a pipe.
+expect()
+{
+    name="$1"
+    expected="$2"
+    input="$3"
+    shift 3
+
+    printf '%b' "$input" > "$work/input"
+    printf '%b' "$expected" > "$work/expected"
+
+    "$cli" "$@" "$work/input" > "$work/mapped" || fail "$name (mapped): exit code"
+    cmp -s "$work/mapped" "$work/expected" || fail "$name (mapped): output"
+
+    "$cli" "$@" < "$work/input" > "$work/streamed" || fail "$name (streamed): exit code"
+    cmp -s "$work/streamed" "$work/expected" || fail "$name (streamed): output"
+}
+
+# reject NAME INPUT ARGS... - expects the tool to fail on INPUT from a file and from a pipe.
+reject()
+{
+    name="$1"
+    input="$2"
+    shift 2
+
+    printf '%b' "$input" > "$work/input"
+
+    "$cli" "$@" "$work/input" > /dev/null 2>&1 && fail "$name (mapped): accepted"
+    "$cli" "$@" < "$work/input" > /dev/null 2>&1 && fail "$name (streamed): accepted"
+}
+
+text="The quick brown fox jumps over the lazy dog. The quick brown fox jumps over the lazy dog."
+wrapped="VGhlIHF1aWNrIGJyb3duIGZveCBqdW1wcyBvdmVyIHRoZSBsYXp5IGRvZy4gVGhlIHF1aWNrIGJy\nb3duIGZveCBqdW1wcyBvdmVyIHRoZSBsYXp5IGRvZy4=\n"
+
+expect "encode wraps at 76 columns" "$wrapped" "$text"
+expect "encode of nothing" "" ""
+expect "encode on one line" "Zm9vYmFy" "foobar" -w 0
+expect "encode wraps at any width" "Zm9v\nYmFy\n" "foobar" -w 4
+expect "encode wraps partial lines" "Zm9vY\nmFy\n" "foobar" -w 5
+expect "encode Base32" "MZXW6YTBOI======\n" "foobar" --base32
+
+expect "decode trailing line feed" "foobar" "Zm9vYmFy\n" -d
+expect "decode trailing CRLF" "foobar" "Zm9vYmFy\r\n" -d
+expect "decode without line feed" "foobar" "Zm9vYmFy" -d
+expect "decode wrapped" "$text" "$wrapped" -d
+expect "decode wrapped CRLF" "foobar" "Zm9v\r\nYmFy\r\n" -d
+expect "decode Base32 wrapped" "foobar" "MZXW6Y\nTBOI======\n" -d --base32
+expect "decode ignoring garbage" "foobar" "Zm9v!Ym\rFy\n" -d -i
+
+reject "decode invalid character" "Zm9v!mFy\n" -d
+reject "decode lone carriage return" "Zm9v\rYmFy\n" -d
+reject "decode trailing carriage return" "Zm9vYmFy\r" -d
+reject "decode space" "Zm9v YmFy\n" -d
+
+if [ "$failures" -ne 0 ]
+then
+    echo "$failures check(s) failed" >&2
+    exit 1
+fi
@@ -1,10 +1,34 @@
 #include <catch2/catch.hpp>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <memory_resource>
+#include <random>
+#include <ranges>
+#include <sstream>
 #include <system_error>
+#include <thread>
+#include <type_traits>
 
 #include <base_codec/base16.hpp>
 #include <base_codec/base32.hpp>
 #include <base_codec/base64.hpp>
+#include <base_codec/batch.hpp>
+#include <base_codec/dispatch.hpp>
+#include <base_codec/memory_resource.hpp>
+#include <base_codec/parallel.hpp>
+#include <base_codec/pipeline.hpp>
+#include <base_codec/streambuf.hpp>
+#include <base_codec/views.hpp>
+
+#include <unistd.h>
 
 
 TEST_CASE(
@@ -130,6 +154,13 @@ TEST_CASE(
         rs::base_codec::base16_decode("F", ec);
         REQUIRE(ec);
     }
+
+    SECTION("Decode lower case '666f6f626172'")
+    {
+        std::error_code ec;
+        REQUIRE(rs::base_codec::base16_decode("666f6F626172", ec) == std::vector<std::uint8_t>{'f', 'o', 'o', 'b', 'a', 'r'});
+        REQUIRE_FALSE(ec);
+    }
 }
 
 TEST_CASE(
@@ -142,6 +173,19 @@ TEST_CASE(
         REQUIRE(rs::base_codec::is_base16("666F6F626172"));
         REQUIRE_FALSE(rs::base_codec::is_base16("Zm9vYmFy"));
     }
+
+    SECTION("Report the first invalid character")
+    {
+        rs::base_codec::validation_error error;
+
+        REQUIRE(rs::base_codec::is_base16("666f6F626172", error));
+        REQUIRE_FALSE(rs::base_codec::is_base16("666F6G626172", error));
+        REQUIRE(error.offset == 5);
+        REQUIRE(error.value == 'G');
+        REQUIRE_FALSE(rs::base_codec::is_base16("666F6F62617", error));
+        REQUIRE(error.offset == 11);
+        REQUIRE(error.value == '\0');
+    }
 }
 
 TEST_CASE(
@@ -271,6 +315,30 @@ TEST_CASE(
         REQUIRE(rs::base_codec::is_base32("MZXW6YTBOI======"));
         REQUIRE_FALSE(rs::base_codec::is_base32("daskjdasd-9uas900909009asdasd"));
     }
+
+    SECTION("Validate padding and length")
+    {
+        rs::base_codec::validation_error error;
+
+        REQUIRE(rs::base_codec::is_base32("MZXW6YTBOI", error));
+        REQUIRE(rs::base_codec::is_base32("MZXW6YQ=", error));
+        REQUIRE(rs::base_codec::is_base32("", error));
+        REQUIRE_FALSE(rs::base_codec::is_base32("MZXW6YTBOI=====", error));
+        REQUIRE(error.offset == 15);
+        REQUIRE_FALSE(rs::base_codec::is_base32("MZXW6YTBOI=======", error));
+        REQUIRE(error.offset == 16);
+        REQUIRE(error.value == '=');
+        REQUIRE_FALSE(rs::base_codec::is_base32("MZXW6YTBO=======", error));
+        REQUIRE(error.offset == 9);
+        REQUIRE_FALSE(rs::base_codec::is_base32("MZ======MZXW6YQ=", error));
+        REQUIRE(error.offset == 8);
+        REQUIRE(error.value == 'M');
+        REQUIRE_FALSE(rs::base_codec::is_base32("MZXW6YTB=", error));
+        REQUIRE(error.offset == 8);
+        REQUIRE_FALSE(rs::base_codec::is_base32("MZX", error));
+        REQUIRE(error.offset == 3);
+        REQUIRE(error.value == '\0');
+    }
 }
 
 TEST_CASE(
@@ -455,6 +523,32 @@ TEST_CASE(
         REQUIRE(rs::base_codec::is_base64("Zm9vYmFy"));
         REQUIRE_FALSE(rs::base_codec::is_base64("****"));
     }
+
+    SECTION("Validate padding and length")
+    {
+        rs::base_codec::validation_error error;
+
+        REQUIRE(rs::base_codec::is_base64("Zm9vYg==", error));
+        REQUIRE(rs::base_codec::is_base64("Zm9vYg", error));
+        REQUIRE(rs::base_codec::is_base64("Zm9vYmE=", error));
+        REQUIRE_FALSE(rs::base_codec::is_base64("Zm9vYg=", error));
+        REQUIRE(error.offset == 7);
+        REQUIRE(error.value == '\0');
+        REQUIRE_FALSE(rs::base_codec::is_base64("Zm9vYmE==", error));
+        REQUIRE(error.offset == 8);
+        REQUIRE(error.value == '=');
+        REQUIRE_FALSE(rs::base_codec::is_base64("Zm=9vYmFy", error));
+        REQUIRE(error.offset == 3);
+        REQUIRE(error.value == '9');
+        REQUIRE_FALSE(rs::base_codec::is_base64("Zm8=Zm8=", error));
+        REQUIRE(error.offset == 4);
+        REQUIRE(error.value == 'Z');
+        REQUIRE_FALSE(rs::base_codec::is_base64("Zm9vY", error));
+        REQUIRE(error.offset == 5);
+        REQUIRE_FALSE(rs::base_codec::is_base64("Zm9v Yg==", error));
+        REQUIRE(error.offset == 4);
+        REQUIRE(error.value == ' ');
+    }
 }
 
 TEST_CASE(
@@ -579,3 +673,1652 @@ TEST_CASE(
     }
 }
 
+
+static auto random_bytes(std::size_t a_size, std::uint32_t a_seed) -> std::vector<std::uint8_t>
+{
+    std::mt19937 generator {a_seed};
+    std::uniform_int_distribution<int> distribution {0, 255};
+    std::vector<std::uint8_t> ret(a_size);
+
+    for (auto& datum : ret)
+    {
+        datum = static_cast<std::uint8_t>(distribution(generator));
+    }
+
+    return ret;
+}
+
+static auto lower_case(std::string a_data) -> std::string
+{
+    for (auto& datum : a_data)
+    {
+        datum = static_cast<char>(std::tolower(static_cast<unsigned char>(datum)));
+    }
+
+    return a_data;
+}
+
+static auto supported_kernel_tiers() -> std::vector<rs::base_codec::kernel_tier>
+{
+    std::vector<rs::base_codec::kernel_tier> ret;
+
+    for (auto const tier : {
+        rs::base_codec::kernel_tier::scalar,
+        rs::base_codec::kernel_tier::sse41,
+        rs::base_codec::kernel_tier::avx2,
+        rs::base_codec::kernel_tier::avx512
+    })
+    {
+        if (rs::base_codec::is_kernel_tier_supported(tier))
+        {
+            ret.push_back(tier);
+        }
+    }
+
+    return ret;
+}
+
+TEST_CASE(
+    "Caller provided buffers",
+    "[encode_into][decode_into]"
+)
+{
+    SECTION("Sizes match the encoded strings")
+    {
+        for (std::size_t size = 0; size < 40; ++size)
+        {
+            INFO("size " << size);
+            auto const data = random_bytes(size, static_cast<std::uint32_t>(size));
+
+            std::error_code ec;
+            auto const base16 = rs::base_codec::base16_encode(data, ec);
+            auto const base32 = rs::base_codec::base32_encode(data, ec);
+            auto const base32_unpadded = rs::base_codec::base32_encode(data, ec, false);
+            auto const base64 = rs::base_codec::base64_encode(data, ec);
+            auto const base64_unpadded = rs::base_codec::base64_encode(data, ec, false);
+
+            REQUIRE(rs::base_codec::base16_encoded_size(size) == base16.size());
+            REQUIRE(rs::base_codec::base32_encoded_size(size) == base32.size());
+            REQUIRE(rs::base_codec::base32_encoded_size(size, false) == base32_unpadded.size());
+            REQUIRE(rs::base_codec::base64_encoded_size(size) == base64.size());
+            REQUIRE(rs::base_codec::base64_encoded_size(size, false) == base64_unpadded.size());
+
+            REQUIRE(rs::base_codec::base16_decoded_size(base16) == size);
+            REQUIRE(rs::base_codec::base32_decoded_size(base32) == size);
+            REQUIRE(rs::base_codec::base32_decoded_size(base32_unpadded) == size);
+            REQUIRE(rs::base_codec::base64_decoded_size(base64) == size);
+            REQUIRE(rs::base_codec::base64_decoded_size(base64_unpadded) == size);
+        }
+
+        static_assert(rs::base_codec::base64_encoded_size(4) == 8);
+        static_assert(rs::base_codec::base64_decoded_size("Zm9vYg==") == 4);
+    }
+
+    SECTION("Encode and decode without allocating")
+    {
+        auto const data = random_bytes(1000, 1000);
+        char encoded[2000];
+        std::uint8_t decoded[1000];
+
+        std::error_code ec;
+        auto written = rs::base_codec::base64_encode_into(data, encoded, ec);
+        REQUIRE_FALSE(ec);
+        REQUIRE(std::string_view(encoded, written) == rs::base_codec::base64_encode(data, ec));
+
+        written = rs::base_codec::base64_decode_into(std::string_view(encoded, written), decoded, ec);
+        REQUIRE_FALSE(ec);
+        REQUIRE(std::vector<std::uint8_t>(decoded, decoded + written) == data);
+
+        written = rs::base_codec::base32hex_encode_into(data, encoded, ec);
+        REQUIRE_FALSE(ec);
+        written = rs::base_codec::base32hex_decode_into(std::string_view(encoded, written), decoded, ec);
+        REQUIRE_FALSE(ec);
+        REQUIRE(std::vector<std::uint8_t>(decoded, decoded + written) == data);
+
+        written = rs::base_codec::base16_encode_into(data, encoded, ec);
+        REQUIRE_FALSE(ec);
+        written = rs::base_codec::base16_decode_into(std::string_view(encoded, written), decoded, ec);
+        REQUIRE_FALSE(ec);
+        REQUIRE(std::vector<std::uint8_t>(decoded, decoded + written) == data);
+    }
+
+    SECTION("Buffers that are too small are an error")
+    {
+        std::vector<std::uint8_t> const data = {'f', 'o', 'o', 'b', 'a', 'r'};
+        char encoded[7];
+        std::uint8_t decoded[5];
+
+        std::error_code ec;
+        REQUIRE(rs::base_codec::base64_encode_into(data, encoded, ec) == 0);
+        REQUIRE(ec == std::errc::no_buffer_space);
+
+        ec.clear();
+        REQUIRE(rs::base_codec::base64url_decode_into("Zm9vYmFy", decoded, ec) == 0);
+        REQUIRE(ec == std::errc::no_buffer_space);
+
+        ec.clear();
+        REQUIRE(rs::base_codec::base32_decode_into("MZXW6YQ=", decoded, ec) == 4);
+        REQUIRE_FALSE(ec);
+    }
+}
+
+TEST_CASE(
+    "Generic byte ranges",
+    "[byte_range]"
+)
+{
+    SECTION("Encode any contiguous byte range")
+    {
+        std::string const text = "foobar";
+        std::array<std::byte, 3> const bytes = {std::byte {'f'}, std::byte {'o'}, std::byte {'o'}};
+        std::vector<char> const chars = {'f', 'o'};
+
+        std::error_code ec;
+        REQUIRE(rs::base_codec::base64_encode(text, ec) == "Zm9vYmFy");
+        REQUIRE(rs::base_codec::base64url_encode(std::span(bytes), ec) == "Zm9v");
+        REQUIRE(rs::base_codec::base32_encode(chars, ec) == "MZXQ====");
+        REQUIRE(rs::base_codec::base32hex_encode(std::string_view("foob"), ec) == "CPNMUOG=");
+        REQUIRE(rs::base_codec::base16_encode(bytes, ec) == "666F6F");
+        REQUIRE_FALSE(ec);
+    }
+
+    SECTION("Decode into a chosen container")
+    {
+        std::error_code ec;
+        REQUIRE(rs::base_codec::base64_decode<std::string>("Zm9vYmFy", ec) == "foobar");
+        REQUIRE(rs::base_codec::base64url_decode<std::string>("Zm9vYg", ec) == "foob");
+        REQUIRE(rs::base_codec::base32_decode<std::string>("MZXW6YQ=", ec) == "foob");
+        REQUIRE(rs::base_codec::base32hex_decode<std::vector<char>>("CPNG====", ec) == std::vector<char>{'f', 'o'});
+        REQUIRE(rs::base_codec::base16_decode<std::string>("666f6F", ec) == "foo");
+        REQUIRE_FALSE(ec);
+
+        REQUIRE(rs::base_codec::base64_decode<std::string>("Zm9v*mFy", ec).empty());
+        REQUIRE(ec);
+    }
+
+    SECTION("Encode and decode into ranges of other byte types")
+    {
+        std::string encoded(8, '\0');
+        std::array<std::byte, 6> decoded {};
+
+        std::error_code ec;
+        REQUIRE(rs::base_codec::base64_encode_into(std::string("foobar"), encoded, ec) == 8);
+        REQUIRE(encoded == "Zm9vYmFy");
+        REQUIRE(rs::base_codec::base64_decode_into(encoded, decoded, ec) == 6);
+        REQUIRE(decoded[5] == std::byte {'r'});
+        REQUIRE_FALSE(ec);
+    }
+}
+
+TEST_CASE(
+    "Append and sink encoders",
+    "[encode_append][encode_to]"
+)
+{
+    SECTION("Append to an existing string")
+    {
+        std::string header = "Authorization: Basic ";
+
+        std::error_code ec;
+        REQUIRE(rs::base_codec::base64_encode_append(std::string_view("user:pass"), header, ec) == 12);
+        REQUIRE(header == "Authorization: Basic dXNlcjpwYXNz");
+
+        header += ", ";
+        rs::base_codec::base16_encode_append(std::string_view("foo"), header, ec);
+        rs::base_codec::base32_encode_append(std::string_view("f"), header, ec, false);
+        REQUIRE(header == "Authorization: Basic dXNlcjpwYXNz, 666F6FMY");
+        REQUIRE_FALSE(ec);
+    }
+
+    SECTION("Sinks match the string encoders across chunks")
+    {
+        auto const data = random_bytes(20000, 20000);
+
+        std::error_code ec;
+        auto const check = [&](std::string const& a_expected, auto a_encode_to)
+        {
+            std::string through_iterator;
+            a_encode_to(std::back_inserter(through_iterator));
+            REQUIRE(through_iterator == a_expected);
+
+            std::string through_callback;
+            std::size_t chunks = 0;
+            a_encode_to([&](std::string_view a_chunk) { through_callback += a_chunk; ++chunks; });
+            REQUIRE(through_callback == a_expected);
+            REQUIRE(chunks > 1);
+        };
+
+        check(rs::base_codec::base16_encode(data, ec),
+              [&](auto a_out) { return rs::base_codec::base16_encode_to(data, a_out, ec); });
+        check(rs::base_codec::base32_encode(data, ec),
+              [&](auto a_out) { return rs::base_codec::base32_encode_to(data, a_out, ec); });
+        check(rs::base_codec::base32hex_encode(data, ec, false),
+              [&](auto a_out) { return rs::base_codec::base32hex_encode_to(data, a_out, ec, false); });
+        check(rs::base_codec::base64_encode(data, ec),
+              [&](auto a_out) { return rs::base_codec::base64_encode_to(data, a_out, ec); });
+        check(rs::base_codec::base64url_encode(data, ec),
+              [&](auto a_out) { return rs::base_codec::base64url_encode_to(data, a_out, ec); });
+        REQUIRE_FALSE(ec);
+    }
+}
+
+TEST_CASE(
+    "Polymorphic allocators",
+    "[pmr]"
+)
+{
+    SECTION("Outputs come from the given resource")
+    {
+        std::array<std::byte, 4096> arena;
+        std::pmr::monotonic_buffer_resource resource(
+            arena.data(),
+            arena.size(),
+            std::pmr::null_memory_resource()
+        );
+
+        std::error_code ec;
+        auto const encoded = rs::base_codec::base64_encode(std::string_view("foobar"), ec, &resource);
+        REQUIRE(encoded == "Zm9vYmFy");
+        REQUIRE(encoded.get_allocator().resource() == &resource);
+
+        auto const decoded = rs::base_codec::base64_decode(encoded, ec, &resource);
+        REQUIRE(decoded == std::pmr::vector<std::uint8_t>{'f', 'o', 'o', 'b', 'a', 'r'});
+        REQUIRE(decoded.get_allocator().resource() == &resource);
+
+        REQUIRE(rs::base_codec::base16_encode(std::string_view("foo"), ec, &resource) == "666F6F");
+        REQUIRE(rs::base_codec::base32hex_decode("CPNG====", ec, &resource).size() == 2);
+        REQUIRE(rs::base_codec::base64url_encode(std::string_view("foob"), ec, &resource) == "Zm9vYg");
+        REQUIRE_FALSE(ec);
+    }
+
+    SECTION("Huge page resource")
+    {
+        rs::base_codec::huge_page_resource resource(1 << 16);
+        auto const data = random_bytes(1 << 17, 17);
+
+        std::error_code ec;
+        auto const small = rs::base_codec::base16_encode(random_bytes(100, 100), ec, &resource);
+        auto const large = rs::base_codec::base64_encode(data, ec, &resource);
+        auto const decoded = rs::base_codec::base64_decode(large, ec, &resource);
+        REQUIRE_FALSE(ec);
+
+        REQUIRE(reinterpret_cast<std::uintptr_t>(small.data()) % 64 == 0);
+        REQUIRE(reinterpret_cast<std::uintptr_t>(large.data()) % 64 == 0);
+        REQUIRE(std::equal(decoded.begin(), decoded.end(), data.begin(), data.end()));
+        REQUIRE(rs::base_codec::huge_page_resource_instance()->is_equal(
+            *rs::base_codec::huge_page_resource_instance()
+        ));
+    }
+}
+
+TEST_CASE(
+    "In-place encode and decode",
+    "[encode_inplace][decode_inplace]"
+)
+{
+    auto const initial = rs::base_codec::active_kernel_tier();
+
+    for (auto const tier : supported_kernel_tiers())
+    {
+        std::error_code ec;
+        rs::base_codec::set_kernel_tier(tier, ec);
+        REQUIRE_FALSE(ec);
+
+        for (std::size_t size : {0, 1, 2, 3, 4, 5, 7, 10, 17, 64, 65, 100, 257, 1000, 4099, 100003})
+        {
+            INFO("tier " << rs::base_codec::kernel_tier_name(tier) << ", size " << size);
+            auto const data = random_bytes(size, static_cast<std::uint32_t>(size));
+
+            auto const check = [&](std::string const& a_expected, auto a_encode, auto a_decode)
+            {
+                std::string buffer(a_expected.size(), '\0');
+                std::copy(data.begin(), data.end(), buffer.begin());
+
+                std::error_code inplace_ec;
+                auto const encoded = a_encode(std::span<char>(buffer), size, inplace_ec);
+                REQUIRE_FALSE(inplace_ec);
+                REQUIRE(buffer.substr(0, encoded) == a_expected);
+
+                auto const decoded = a_decode(std::span<char>(buffer.data(), encoded), inplace_ec);
+                REQUIRE_FALSE(inplace_ec);
+                REQUIRE(std::vector<std::uint8_t>(buffer.begin(), buffer.begin() + decoded) == data);
+            };
+
+            check(rs::base_codec::base16_encode(data, ec),
+                  [](auto a_buffer, auto a_size, auto& a_ec) { return rs::base_codec::base16_encode_inplace(a_buffer, a_size, a_ec); },
+                  [](auto a_buffer, auto& a_ec) { return rs::base_codec::base16_decode_inplace(a_buffer, a_ec); });
+            check(rs::base_codec::base32_encode(data, ec),
+                  [](auto a_buffer, auto a_size, auto& a_ec) { return rs::base_codec::base32_encode_inplace(a_buffer, a_size, a_ec); },
+                  [](auto a_buffer, auto& a_ec) { return rs::base_codec::base32_decode_inplace(a_buffer, a_ec); });
+            check(rs::base_codec::base32hex_encode(data, ec, false),
+                  [](auto a_buffer, auto a_size, auto& a_ec) { return rs::base_codec::base32hex_encode_inplace(a_buffer, a_size, a_ec, false); },
+                  [](auto a_buffer, auto& a_ec) { return rs::base_codec::base32hex_decode_inplace(a_buffer, a_ec); });
+            check(rs::base_codec::base64_encode(data, ec),
+                  [](auto a_buffer, auto a_size, auto& a_ec) { return rs::base_codec::base64_encode_inplace(a_buffer, a_size, a_ec); },
+                  [](auto a_buffer, auto& a_ec) { return rs::base_codec::base64_decode_inplace(a_buffer, a_ec); });
+            check(rs::base_codec::base64url_encode(data, ec),
+                  [](auto a_buffer, auto a_size, auto& a_ec) { return rs::base_codec::base64url_encode_inplace(a_buffer, a_size, a_ec); },
+                  [](auto a_buffer, auto& a_ec) { return rs::base_codec::base64url_decode_inplace(a_buffer, a_ec); });
+        }
+    }
+
+    SECTION("Buffers without room for the encoding are an error")
+    {
+        std::string buffer = "foobar!";
+
+        std::error_code ec;
+        REQUIRE(rs::base_codec::base64_encode_inplace(buffer, 6, ec) == 0);
+        REQUIRE(ec == std::errc::no_buffer_space);
+    }
+
+    std::error_code ec;
+    rs::base_codec::set_kernel_tier(initial, ec);
+    REQUIRE_FALSE(ec);
+}
+
+TEST_CASE(
+    "Streaming encoders and decoders",
+    "[encoder][decoder]"
+)
+{
+    auto const initial = rs::base_codec::active_kernel_tier();
+
+    // NOTE - Feeds the input in chunks of a varying size, so chunk boundaries land on every
+    //        offset within a block.
+    auto const encode_chunked = [](auto a_encoder, std::vector<std::uint8_t> const& a_data)
+    {
+        std::string ret;
+        std::error_code ec;
+
+        for (std::size_t pos = 0, chunk = 0; pos < a_data.size(); pos += chunk)
+        {
+            chunk = std::min(pos % 13 + 1, a_data.size() - pos);
+            a_encoder.update(std::span(a_data).subspan(pos, chunk), ret, ec);
+        }
+
+        a_encoder.finish(ret, ec);
+        REQUIRE_FALSE(ec);
+        return ret;
+    };
+
+    auto const decode_chunked = [](auto a_decoder, std::string const& a_data)
+    {
+        std::vector<std::uint8_t> ret;
+        std::error_code ec;
+
+        for (std::size_t pos = 0, chunk = 0; pos < a_data.size(); pos += chunk)
+        {
+            chunk = std::min(pos % 11 + 1, a_data.size() - pos);
+            a_decoder.update(std::string_view(a_data).substr(pos, chunk), ret, ec);
+        }
+
+        a_decoder.finish(ec);
+        REQUIRE_FALSE(ec);
+        return ret;
+    };
+
+    for (auto const tier : supported_kernel_tiers())
+    {
+        std::error_code ec;
+        rs::base_codec::set_kernel_tier(tier, ec);
+        REQUIRE_FALSE(ec);
+
+        for (std::size_t size : {0, 1, 2, 3, 4, 5, 7, 10, 17, 64, 65, 100, 257, 1000, 4099})
+        {
+            INFO("tier " << rs::base_codec::kernel_tier_name(tier) << ", size " << size);
+            auto const data = random_bytes(size, static_cast<std::uint32_t>(size));
+
+            auto const base16 = rs::base_codec::base16_encode(data, ec);
+            auto const base32 = rs::base_codec::base32_encode(data, ec);
+            auto const base32hex = rs::base_codec::base32hex_encode(data, ec);
+            auto const base64 = rs::base_codec::base64_encode(data, ec);
+            auto const base64url = rs::base_codec::base64url_encode(data, ec);
+
+            REQUIRE(encode_chunked(rs::base_codec::base16_encoder(), data) == base16);
+            REQUIRE(encode_chunked(rs::base_codec::base32_encoder(), data) == base32);
+            REQUIRE(encode_chunked(rs::base_codec::base32hex_encoder(), data) == base32hex);
+            REQUIRE(encode_chunked(rs::base_codec::base64_encoder(), data) == base64);
+            REQUIRE(encode_chunked(rs::base_codec::base64url_encoder(), data) == base64url);
+            REQUIRE(encode_chunked(rs::base_codec::base64_encoder(false), data) ==
+                    rs::base_codec::base64_encode(data, ec, false));
+
+            REQUIRE(decode_chunked(rs::base_codec::base16_decoder(), base16) == data);
+            REQUIRE(decode_chunked(rs::base_codec::base32_decoder(), base32) == data);
+            REQUIRE(decode_chunked(rs::base_codec::base32hex_decoder(), base32hex) == data);
+            REQUIRE(decode_chunked(rs::base_codec::base64_decoder(), base64) == data);
+            REQUIRE(decode_chunked(rs::base_codec::base64url_decoder(), base64url) == data);
+        }
+    }
+
+    SECTION("Lenient decoders skip characters across chunks")
+    {
+        auto const data = random_bytes(1000, 1000);
+
+        std::error_code ec;
+        auto encoded = rs::base_codec::base64_encode(data, ec);
+
+        for (std::size_t pos = 76; pos < encoded.size(); pos += 78)
+        {
+            encoded.insert(pos, "\r\n");
+        }
+
+        REQUIRE(decode_chunked(rs::base_codec::base64_decoder(false), encoded) == data);
+    }
+
+    SECTION("Everything after the padding is ignored")
+    {
+        rs::base_codec::base64_decoder decoder;
+        std::vector<std::uint8_t> out;
+
+        std::error_code ec;
+        decoder.update("Zm9vYg", out, ec);
+        decoder.update("==Zm9v", out, ec);
+        decoder.finish(ec);
+        REQUIRE_FALSE(ec);
+        REQUIRE(std::string(out.begin(), out.end()) == "foob");
+    }
+
+    SECTION("Strict decoders report errors")
+    {
+        std::vector<std::uint8_t> out;
+        std::error_code ec;
+
+        rs::base_codec::base32_decoder decoder;
+        decoder.update("MZXW!", out, ec);
+        REQUIRE(ec == std::errc::invalid_argument);
+
+        ec.clear();
+        rs::base_codec::base16_decoder base16;
+        base16.update("666", out, ec);
+        REQUIRE_FALSE(ec);
+        base16.finish(ec);
+        REQUIRE(ec == std::errc::invalid_argument);
+    }
+
+    SECTION("Buffers that are too small are an error")
+    {
+        rs::base_codec::base64_encoder encoder;
+        std::array<std::uint8_t, 6> data {};
+        std::array<char, 4> out {};
+
+        std::error_code ec;
+        REQUIRE(encoder.update(data, out, ec) == 0);
+        REQUIRE(ec == std::errc::no_buffer_space);
+    }
+
+    std::error_code ec;
+    rs::base_codec::set_kernel_tier(initial, ec);
+    REQUIRE_FALSE(ec);
+}
+
+TEST_CASE(
+    "Stream buffers",
+    "[streambuf]"
+)
+{
+    SECTION("Encoding through an ostream")
+    {
+        for (std::size_t size : {0, 1, 2, 5, 100, 3839, 3840, 3841, 10000, 100003})
+        {
+            INFO("size " << size);
+            auto const data = random_bytes(size, static_cast<std::uint32_t>(size));
+
+            std::error_code ec;
+            std::ostringstream sink;
+            rs::base_codec::base64_ostreambuf buffer(sink.rdbuf());
+            std::ostream out(&buffer);
+
+            // NOTE - Mix single characters, small writes and writes larger than the buffer.
+            std::size_t pos = 0;
+
+            for (std::size_t chunk = 1; pos < size; pos += chunk, chunk = chunk * 3 + 1)
+            {
+                chunk = std::min(chunk, size - pos);
+
+                if (chunk == 1)
+                {
+                    out.put(static_cast<char>(data[pos]));
+                } else
+                {
+                    out.write(reinterpret_cast<char const*>(data.data() + pos), chunk);
+                }
+            }
+
+            buffer.finish(ec);
+            REQUIRE_FALSE(ec);
+            REQUIRE(out.good());
+            REQUIRE(sink.str() == rs::base_codec::base64_encode(data, ec));
+        }
+    }
+
+    SECTION("Decoding through an istream")
+    {
+        for (std::size_t size : {0, 1, 2, 5, 100, 3071, 3072, 3073, 10000, 100003})
+        {
+            INFO("size " << size);
+            auto const data = random_bytes(size, static_cast<std::uint32_t>(size));
+
+            std::error_code ec;
+            std::istringstream source(rs::base_codec::base32_encode(data, ec));
+            rs::base_codec::base32_istreambuf buffer(source.rdbuf());
+            std::istream in(&buffer);
+
+            std::vector<std::uint8_t> decoded(
+                (std::istreambuf_iterator<char>(in)),
+                std::istreambuf_iterator<char>()
+            );
+
+            REQUIRE_FALSE(buffer.error());
+            REQUIRE(decoded == data);
+        }
+    }
+
+    SECTION("Destructor finishes the encoding")
+    {
+        std::ostringstream sink;
+
+        {
+            rs::base_codec::base16_ostreambuf buffer(sink.rdbuf());
+            std::ostream out(&buffer);
+            out << "foobar";
+        }
+
+        REQUIRE(sink.str() == "666F6F626172");
+    }
+
+    SECTION("Decoding errors end the stream")
+    {
+        std::istringstream source("Zm9v!mFy");
+        rs::base_codec::base64_istreambuf buffer(source.rdbuf());
+        std::istream in(&buffer);
+
+        std::string decoded;
+        in >> decoded;
+
+        REQUIRE(decoded == "foo");
+        REQUIRE(buffer.error() == std::errc::invalid_argument);
+    }
+
+    SECTION("Decoding errors keep the bytes before them")
+    {
+        // NOTE - Past the first chunk the stream buffer reads, with the error in the second one.
+        auto const encoded = std::string(4400, 'A') + "*AAAA";
+        std::istringstream source(encoded);
+        rs::base_codec::base64_istreambuf buffer(source.rdbuf());
+        std::istream in(&buffer);
+
+        std::vector<std::uint8_t> decoded(
+            (std::istreambuf_iterator<char>(in)),
+            std::istreambuf_iterator<char>()
+        );
+
+        REQUIRE(decoded == std::vector<std::uint8_t>(3300, 0));
+        REQUIRE(buffer.error() == std::errc::invalid_argument);
+    }
+}
+
+TEST_CASE(
+    "Range views",
+    "[views]"
+)
+{
+    namespace views = rs::base_codec::views;
+
+    auto const to_string = [](auto&& a_range)
+    {
+        std::string ret;
+        std::ranges::copy(a_range, std::back_inserter(ret));
+        return ret;
+    };
+
+    auto const to_bytes = [](auto&& a_range)
+    {
+        std::vector<std::uint8_t> ret;
+        std::ranges::copy(a_range, std::back_inserter(ret));
+        return ret;
+    };
+
+    SECTION("Views match the one-shot functions")
+    {
+        for (std::size_t size : {0, 1, 2, 3, 4, 5, 7, 17, 239, 240, 241, 1000, 4099})
+        {
+            INFO("size " << size);
+            auto const data = random_bytes(size, static_cast<std::uint32_t>(size));
+
+            std::error_code ec;
+            auto const base16 = rs::base_codec::base16_encode(data, ec);
+            auto const base32 = rs::base_codec::base32_encode(data, ec);
+            auto const base32hex = rs::base_codec::base32hex_encode(data, ec);
+            auto const base64 = rs::base_codec::base64_encode(data, ec);
+            auto const base64url = rs::base_codec::base64url_encode(data, ec);
+
+            REQUIRE(to_string(data | views::base16_encode) == base16);
+            REQUIRE(to_string(data | views::hex) == base16);
+            REQUIRE(to_string(data | views::base32_encode) == base32);
+            REQUIRE(to_string(data | views::base32hex_encode) == base32hex);
+            REQUIRE(to_string(data | views::base64_encode) == base64);
+            REQUIRE(to_string(data | views::base64url_encode) == base64url);
+
+            REQUIRE(to_bytes(base16 | views::base16_decode) == data);
+            REQUIRE(to_bytes(base16 | views::unhex) == data);
+            REQUIRE(to_bytes(base32 | views::base32_decode) == data);
+            REQUIRE(to_bytes(base32hex | views::base32hex_decode) == data);
+            REQUIRE(to_bytes(base64 | views::base64_decode) == data);
+            REQUIRE(to_bytes(base64url | views::base64url_decode) == data);
+        }
+    }
+
+    SECTION("Views compose with the standard adaptors")
+    {
+        std::string const encoded = "Zm9vYmFyYmF6";
+
+        REQUIRE(to_string(encoded | views::base64_decode | std::views::take(3)) == "foo");
+        REQUIRE(
+            to_string(std::string_view("foobar") | views::base64_encode | std::views::take(4)) ==
+            "Zm9v"
+        );
+
+        // NOTE - Not contiguous, so every chunk gets gathered through a copy.
+        auto const letters = std::views::iota(0, 26) | std::views::transform(
+            [](int a_i) { return static_cast<char>('a' + a_i); }
+        );
+        auto const data = to_bytes(letters);
+
+        std::error_code ec;
+        auto const base32 = rs::base_codec::base32_encode(data, ec);
+        REQUIRE(to_string(letters | views::base32_encode) == base32);
+
+        auto filtered = base32 | std::views::filter([](char a_c) { return a_c != '='; });
+        REQUIRE(to_bytes(filtered | views::base32_decode) == data);
+    }
+
+    SECTION("Decoding ends at the first invalid character")
+    {
+        std::string const encoded = "Zm9v!mFy";
+        auto view = encoded | views::base64_decode;
+        REQUIRE(view.error() == std::error_code {});
+        REQUIRE(to_string(view) == "foo");
+        REQUIRE(view.error() == std::make_error_code(std::errc::invalid_argument));
+
+        std::string const valid = "Zm9vYmFy";
+        auto valid_view = valid | views::base64_decode;
+        REQUIRE(to_string(valid_view) == "foobar");
+        REQUIRE_FALSE(valid_view.error());
+
+        // NOTE - The error reaches the view even if it got moved after `begin()`, with the error
+        //        past the first chunk so it's only found afterwards.
+        auto const late_error = std::string(300, 'A') + "!AAA";
+        auto moved_from = late_error | views::base64_decode;
+        auto iterator = moved_from.begin();
+        auto moved = std::move(moved_from);
+        std::vector<std::uint8_t> prefix;
+
+        for (; iterator != moved.end(); ++iterator)
+        {
+            prefix.push_back(*iterator);
+        }
+
+        REQUIRE(prefix == std::vector<std::uint8_t>(225, 0));
+        REQUIRE(moved.error() == std::make_error_code(std::errc::invalid_argument));
+
+        auto const long_encoded = std::string(400, 'A') + "!AAA";
+        auto long_view = long_encoded | views::base64_decode;
+        REQUIRE(to_bytes(long_view) == std::vector<std::uint8_t>(300, 0));
+        REQUIRE(long_view.error() == std::make_error_code(std::errc::invalid_argument));
+    }
+}
+
+// NOTE - Malformed constants are a substitution failure here rather than a compile error.
+template <rs::base_codec::fixed_string Encoded>
+concept base64_constant = requires {
+    typename std::integral_constant<
+        std::size_t,
+        rs::base_codec::base64_decode_constant<Encoded>().size()
+    >;
+};
+
+template <rs::base_codec::fixed_string Encoded>
+concept base32_constant = requires {
+    typename std::integral_constant<
+        std::size_t,
+        rs::base_codec::base32_decode_constant<Encoded>().size()
+    >;
+};
+
+TEST_CASE(
+    "Compile time constants",
+    "[constant]"
+)
+{
+    using namespace rs::base_codec::literals;
+
+    auto const bytes = [](std::string_view a_data)
+    {
+        return std::vector<std::uint8_t>(a_data.begin(), a_data.end());
+    };
+
+    SECTION("Literals decode at compile time")
+    {
+        static constexpr auto hex = "666F6f626172"_hex;
+        static constexpr auto base32 = "MZXW6YTBOI======"_b32;
+        static constexpr auto base32hex = "CPNMUOJ1E8"_b32hex;
+        static constexpr auto base64 = "Zm9vYmE="_b64;
+        static constexpr auto base64url = "-_-_"_b64url;
+
+        static_assert(std::is_same_v<decltype(hex), std::array<std::uint8_t, 6> const>);
+        static_assert(base64.size() == 5);
+        static_assert(base64url[0] == 0xFB && base64url[1] == 0xFF && base64url[2] == 0xBF);
+
+        REQUIRE(std::vector<std::uint8_t>(hex.begin(), hex.end()) == bytes("foobar"));
+        REQUIRE(std::vector<std::uint8_t>(base32.begin(), base32.end()) == bytes("foobar"));
+        REQUIRE(std::vector<std::uint8_t>(base32hex.begin(), base32hex.end()) == bytes("foobar"));
+        REQUIRE(std::vector<std::uint8_t>(base64.begin(), base64.end()) == bytes("fooba"));
+    }
+
+    SECTION("Constants round trip through the runtime codecs")
+    {
+        static constexpr std::array<std::uint8_t, 7> data {0x00, 0x10, 0x83, 0x10, 0x51, 0x87, 0xFF};
+        static constexpr auto base16 = rs::base_codec::base16_encode_constant(data);
+        static constexpr auto base32 = rs::base_codec::base32_encode_constant(data);
+        static constexpr auto base32hex = rs::base_codec::base32hex_encode_constant<false>(data);
+        static constexpr auto base64 = rs::base_codec::base64_encode_constant(data);
+        static constexpr auto base64url = rs::base_codec::base64url_encode_constant(data);
+
+        std::error_code ec;
+        auto const vector = std::vector<std::uint8_t>(data.begin(), data.end());
+        REQUIRE(std::string(base16.begin(), base16.end()) == rs::base_codec::base16_encode(vector, ec));
+        REQUIRE(std::string(base32.begin(), base32.end()) == rs::base_codec::base32_encode(vector, ec));
+        REQUIRE(std::string(base32hex.begin(), base32hex.end()) ==
+                rs::base_codec::base32hex_encode(vector, ec, false));
+        REQUIRE(std::string(base64.begin(), base64.end()) == rs::base_codec::base64_encode(vector, ec));
+        REQUIRE(std::string(base64url.begin(), base64url.end()) ==
+                rs::base_codec::base64url_encode(vector, ec));
+
+        static constexpr auto decoded = rs::base_codec::base64_decode_constant<"ABCDEFGH/w==">();
+        static_assert(decoded == data);
+    }
+
+    SECTION("Malformed constants don't compile")
+    {
+        static_assert(base64_constant<"Zm9v">);
+        static_assert(base64_constant<"Zg==">);
+        static_assert(base64_constant<"Zg">);
+        static_assert(!base64_constant<"Zm9v====">);
+        static_assert(!base64_constant<"Zg===">);
+        static_assert(!base64_constant<"Zg=">);
+        static_assert(!base64_constant<"====">);
+        static_assert(!base64_constant<"Zh==">);
+        static_assert(!base64_constant<"Zm9=">);
+        static_assert(!base64_constant<"Z!==">);
+
+        static_assert(base32_constant<"MY======">);
+        static_assert(!base32_constant<"MY==============">);
+        static_assert(!base32_constant<"MZ======">);
+    }
+}
+
+TEST_CASE(
+    "Fixed size encode and decode",
+    "[encode_fixed][decode_fixed]"
+)
+{
+    auto const check = [](auto const& a_data)
+    {
+        constexpr auto size = std::tuple_size_v<std::remove_cvref_t<decltype(a_data)>>;
+        INFO("size " << size);
+
+        std::error_code ec;
+        auto const vector = std::vector<std::uint8_t>(a_data.begin(), a_data.end());
+        auto const as_string = [](auto const& a_array) { return std::string(a_array.begin(), a_array.end()); };
+
+        auto const base16 = rs::base_codec::base16_encode_fixed(a_data);
+        auto const base32 = rs::base_codec::base32_encode_fixed(a_data);
+        auto const base32hex = rs::base_codec::base32hex_encode_fixed<false>(a_data);
+        auto const base64 = rs::base_codec::base64_encode_fixed(a_data);
+        auto const base64url = rs::base_codec::base64url_encode_fixed(a_data);
+
+        REQUIRE(as_string(base16) == rs::base_codec::base16_encode(vector, ec));
+        REQUIRE(as_string(base32) == rs::base_codec::base32_encode(vector, ec));
+        REQUIRE(as_string(base32hex) == rs::base_codec::base32hex_encode(vector, ec, false));
+        REQUIRE(as_string(base64) == rs::base_codec::base64_encode(vector, ec));
+        REQUIRE(as_string(base64url) == rs::base_codec::base64url_encode(vector, ec));
+
+        REQUIRE(rs::base_codec::base16_decode_fixed<size>(as_string(base16), ec) == a_data);
+        REQUIRE(rs::base_codec::base16_decode_fixed<size>(lower_case(as_string(base16)), ec) == a_data);
+        REQUIRE(rs::base_codec::base32_decode_fixed<size>(as_string(base32), ec) == a_data);
+        REQUIRE(rs::base_codec::base32hex_decode_fixed<size, false>(as_string(base32hex), ec) == a_data);
+        REQUIRE(rs::base_codec::base64_decode_fixed<size>(as_string(base64), ec) == a_data);
+        REQUIRE(rs::base_codec::base64url_decode_fixed<size>(as_string(base64url), ec) == a_data);
+        REQUIRE_FALSE(ec);
+    };
+
+    auto const random_array = []<std::size_t Size>(std::integral_constant<std::size_t, Size>)
+    {
+        std::array<std::uint8_t, Size> ret {};
+        auto const data = random_bytes(Size, static_cast<std::uint32_t>(Size));
+        std::copy(data.begin(), data.end(), ret.begin());
+        return ret;
+    };
+
+    check(random_array(std::integral_constant<std::size_t, 1> {}));
+    check(random_array(std::integral_constant<std::size_t, 2> {}));
+    check(random_array(std::integral_constant<std::size_t, 4> {}));
+    check(random_array(std::integral_constant<std::size_t, 16> {}));
+    check(random_array(std::integral_constant<std::size_t, 20> {}));
+    check(random_array(std::integral_constant<std::size_t, 32> {}));
+    check(random_array(std::integral_constant<std::size_t, 64> {}));
+
+    SECTION("Usable in constant expressions")
+    {
+        static constexpr std::array<std::uint8_t, 3> data {'f', 'o', 'o'};
+        static_assert(rs::base_codec::base64_encode_fixed(data) == std::array {'Z', 'm', '9', 'v'});
+    }
+
+    SECTION("Malformed input is an error")
+    {
+        std::error_code ec;
+        rs::base_codec::base64_decode_fixed<4>("Zm9vYg=", ec);
+        REQUIRE(ec == std::errc::invalid_argument);
+
+        ec.clear();
+        rs::base_codec::base64_decode_fixed<4>("Zm9vYg!=", ec);
+        REQUIRE(ec == std::errc::invalid_argument);
+
+        ec.clear();
+        rs::base_codec::base64_decode_fixed<4>("Zm9vYgA=", ec);
+        REQUIRE(ec == std::errc::invalid_argument);
+
+        ec.clear();
+        rs::base_codec::base16_decode_fixed<2>("66G6", ec);
+        REQUIRE(ec == std::errc::invalid_argument);
+    }
+}
+
+TEST_CASE(
+    "Columnar batches",
+    "[encode_batch][decode_batch]"
+)
+{
+    auto const check = []<typename Offset>(std::type_identity<Offset>)
+    {
+        INFO("offset size " << sizeof(Offset));
+
+        std::error_code ec;
+        auto const data = random_bytes(1000, 19);
+        std::vector<Offset> offsets {5};
+
+        // NOTE - Every size from empty to a few blocks of every alphabet, kernels included.
+        for (Offset size = 0; offsets.back() + size <= static_cast<Offset>(data.size()); ++size)
+        {
+            offsets.push_back(offsets.back() + size);
+        }
+
+        auto const value = [&](std::size_t a_index)
+        {
+            return std::vector<std::uint8_t>(
+                data.begin() + offsets[a_index],
+                data.begin() + offsets[a_index + 1]
+            );
+        };
+
+        auto const compare = [&](auto const& a_encoded, auto const& a_decoded, auto a_encode)
+        {
+            REQUIRE(a_encoded.offsets.size() == offsets.size());
+            REQUIRE(a_decoded.offsets.size() == offsets.size());
+            REQUIRE(a_encoded.offsets.front() == 0);
+
+            for (std::size_t i = 0; i + 1 < offsets.size(); ++i)
+            {
+                auto const encoded = std::string_view(a_encoded.data).substr(
+                    a_encoded.offsets[i],
+                    a_encoded.offsets[i + 1] - a_encoded.offsets[i]
+                );
+                REQUIRE(encoded == a_encode(value(i)));
+                REQUIRE(a_decoded.offsets[i + 1] == offsets[i + 1] - offsets.front());
+                REQUIRE(std::equal(
+                    a_decoded.data.begin() + a_decoded.offsets[i],
+                    a_decoded.data.begin() + a_decoded.offsets[i + 1],
+                    data.begin() + offsets[i],
+                    data.begin() + offsets[i + 1]
+                ));
+            }
+        };
+
+        auto const base16 = rs::base_codec::base16_encode_batch(data, offsets, ec);
+        compare(
+            base16,
+            rs::base_codec::base16_decode_batch(base16.data, base16.offsets, ec),
+            [&](auto const& a_value) { return rs::base_codec::base16_encode(a_value, ec); }
+        );
+
+        auto const base32 = rs::base_codec::base32_encode_batch(data, offsets, ec);
+        compare(
+            base32,
+            rs::base_codec::base32_decode_batch(base32.data, base32.offsets, ec),
+            [&](auto const& a_value) { return rs::base_codec::base32_encode(a_value, ec); }
+        );
+
+        auto const base32hex = rs::base_codec::base32hex_encode_batch(data, offsets, ec, std::pmr::get_default_resource(), false);
+        compare(
+            base32hex,
+            rs::base_codec::base32hex_decode_batch(base32hex.data, base32hex.offsets, ec),
+            [&](auto const& a_value) { return rs::base_codec::base32hex_encode(a_value, ec, false); }
+        );
+
+        auto const base64 = rs::base_codec::base64_encode_batch(data, offsets, ec);
+        compare(
+            base64,
+            rs::base_codec::base64_decode_batch(base64.data, base64.offsets, ec),
+            [&](auto const& a_value) { return rs::base_codec::base64_encode(a_value, ec); }
+        );
+
+        auto const base64url = rs::base_codec::base64url_encode_batch(data, offsets, ec);
+        compare(
+            base64url,
+            rs::base_codec::base64url_decode_batch(base64url.data, base64url.offsets, ec),
+            [&](auto const& a_value) { return rs::base_codec::base64url_encode(a_value, ec); }
+        );
+
+        REQUIRE_FALSE(ec);
+    };
+
+    check(std::type_identity<std::int32_t> {});
+    check(std::type_identity<std::int64_t> {});
+
+    SECTION("Output comes from the given memory resource")
+    {
+        std::array<std::byte, 256> buffer;
+        std::pmr::monotonic_buffer_resource resource(
+            buffer.data(),
+            buffer.size(),
+            std::pmr::null_memory_resource()
+        );
+        std::error_code ec;
+        std::string const data = "foobar";
+        std::array<std::int32_t, 4> const offsets {0, 3, 3, 6};
+
+        auto const encoded = rs::base_codec::base64_encode_batch(data, offsets, ec, &resource);
+        REQUIRE(encoded.data == "Zm9vYmFy");
+        REQUIRE(encoded.offsets == std::pmr::vector<std::int32_t> {0, 4, 4, 8});
+        REQUIRE(encoded.data.get_allocator().resource() == &resource);
+        REQUIRE_FALSE(ec);
+    }
+
+    SECTION("Empty columns")
+    {
+        std::error_code ec;
+        std::vector<std::int64_t> const offsets;
+
+        auto const encoded = rs::base_codec::base32_encode_batch(std::string(), offsets, ec);
+        REQUIRE(encoded.data.empty());
+        REQUIRE(encoded.offsets.size() == 1);
+        REQUIRE_FALSE(ec);
+    }
+
+    SECTION("Invalid offsets are an error")
+    {
+        std::error_code ec;
+        std::string const data = "foobar";
+
+        rs::base_codec::base64_encode_batch(data, std::vector<std::int32_t> {0, 4, 3}, ec);
+        REQUIRE(ec == std::errc::invalid_argument);
+
+        ec.clear();
+        rs::base_codec::base64_encode_batch(data, std::vector<std::int32_t> {-1, 3}, ec);
+        REQUIRE(ec == std::errc::invalid_argument);
+
+        ec.clear();
+        rs::base_codec::base64_decode_batch(data, std::vector<std::int64_t> {0, 7}, ec);
+        REQUIRE(ec == std::errc::invalid_argument);
+    }
+
+    SECTION("Malformed values are an error")
+    {
+        std::error_code ec;
+
+        auto const decoded = rs::base_codec::base64_decode_batch(
+            std::string("Zm9vYm!y"),
+            std::vector<std::int32_t> {0, 4, 8},
+            ec
+        );
+        REQUIRE(ec == std::errc::invalid_argument);
+        REQUIRE(decoded.data.empty());
+
+        ec.clear();
+        rs::base_codec::base16_decode_batch(std::string("666"), std::vector<std::int32_t> {0, 3}, ec);
+        REQUIRE(ec == std::errc::invalid_argument);
+
+        ec.clear();
+        auto const lenient = rs::base_codec::base64_decode_batch(
+            std::string("Zm9vYm!y"),
+            std::vector<std::int32_t> {0, 4, 8},
+            ec,
+            std::pmr::get_default_resource(),
+            false
+        );
+        REQUIRE_FALSE(ec);
+        REQUIRE(lenient.offsets == std::pmr::vector<std::int32_t> {0, 3, 5});
+    }
+}
+
+TEST_CASE(
+    "Equal sized items",
+    "[encode_items]"
+)
+{
+    auto const initial = rs::base_codec::active_kernel_tier();
+
+    for (auto const tier : supported_kernel_tiers())
+    {
+        std::error_code ec;
+        rs::base_codec::set_kernel_tier(tier, ec);
+        REQUIRE_FALSE(ec);
+
+        // NOTE - Item counts around the 32 lanes of the interleaved kernels, and item sizes with
+        //        and without a tail after their last whole chunk.
+        for (std::size_t item_size : {1, 3, 8, 12, 16, 20, 24, 32, 33, 48, 64})
+        {
+            for (std::size_t items : {1, 15, 16, 17, 31, 32, 33, 100})
+            {
+                INFO("tier " << rs::base_codec::kernel_tier_name(tier) << ", item size "
+                             << item_size << ", items " << items);
+                auto const data = random_bytes(items * item_size, static_cast<std::uint32_t>(items));
+
+                auto const check = [&](std::pmr::string const& a_encoded, auto a_encode)
+                {
+                    REQUIRE(a_encoded.size() % items == 0);
+                    auto const stride = a_encoded.size() / items;
+
+                    for (std::size_t i = 0; i < items; ++i)
+                    {
+                        auto const item = std::vector<std::uint8_t>(
+                            data.begin() + i * item_size,
+                            data.begin() + (i + 1) * item_size
+                        );
+                        REQUIRE(std::string_view(a_encoded).substr(i * stride, stride) == a_encode(item));
+                    }
+                };
+
+                check(
+                    rs::base_codec::base16_encode_items(data, item_size, ec),
+                    [&](auto const& a_item) { return rs::base_codec::base16_encode(a_item, ec); }
+                );
+                check(
+                    rs::base_codec::base64_encode_items(data, item_size, ec),
+                    [&](auto const& a_item) { return rs::base_codec::base64_encode(a_item, ec); }
+                );
+                check(
+                    rs::base_codec::base64url_encode_items(data, item_size, ec),
+                    [&](auto const& a_item) { return rs::base_codec::base64url_encode(a_item, ec); }
+                );
+                check(
+                    rs::base_codec::base64url_encode_items(data, item_size, ec, std::pmr::get_default_resource(), true),
+                    [&](auto const& a_item) { return rs::base_codec::base64url_encode(a_item, ec, true); }
+                );
+                REQUIRE_FALSE(ec);
+            }
+        }
+    }
+
+    std::error_code ec;
+    rs::base_codec::set_kernel_tier(initial, ec);
+
+    SECTION("Item size has to divide the data")
+    {
+        std::string const data = "foobar";
+
+        rs::base_codec::base64_encode_items(data, 4, ec);
+        REQUIRE(ec == std::errc::invalid_argument);
+
+        ec.clear();
+        rs::base_codec::base16_encode_items(data, 0, ec);
+        REQUIRE(ec == std::errc::invalid_argument);
+
+        ec.clear();
+        REQUIRE(rs::base_codec::base64_encode_items(data, 3, ec) == "Zm9vYmFy");
+        REQUIRE(rs::base_codec::base64_encode_items(std::string(), 3, ec).empty());
+        REQUIRE_FALSE(ec);
+    }
+}
+
+TEST_CASE(
+    "Parallel encode",
+    "[parallel]"
+)
+{
+    rs::base_codec::thread_pool pool(4);
+    rs::base_codec::parallel_options const options {&pool, 0};
+
+    SECTION("Chunks match the single threaded encoders")
+    {
+        // NOTE - Sizes just around the smallest split, and ones that aren't whole blocks.
+        for (std::size_t size : {0, 1, 1000, 524287, 524288, 524289, 3000001, 5000003})
+        {
+            INFO("size " << size);
+            auto const data = random_bytes(size, static_cast<std::uint32_t>(size));
+            std::error_code ec;
+
+            REQUIRE(rs::base_codec::base16_encode(data, ec, options) == rs::base_codec::base16_encode(data, ec));
+            REQUIRE(rs::base_codec::base32_encode(data, ec, options) == rs::base_codec::base32_encode(data, ec));
+            REQUIRE(rs::base_codec::base32hex_encode(data, ec, options, false) == rs::base_codec::base32hex_encode(data, ec, false));
+            REQUIRE(rs::base_codec::base64_encode(data, ec, options) == rs::base_codec::base64_encode(data, ec));
+            REQUIRE(rs::base_codec::base64url_encode(data, ec, options) == rs::base_codec::base64url_encode(data, ec));
+            REQUIRE(rs::base_codec::base64url_encode(data, ec, options, true, '.') == rs::base_codec::base64url_encode(data, ec, true, '.'));
+            REQUIRE_FALSE(ec);
+        }
+    }
+
+    SECTION("Chunks decode like the single threaded decoders")
+    {
+        for (std::size_t size : {0, 1000, 524287, 524288, 3000001, 5000003})
+        {
+            INFO("size " << size);
+            auto const data = random_bytes(size, static_cast<std::uint32_t>(size));
+            std::error_code ec;
+
+            REQUIRE(rs::base_codec::base16_decode(rs::base_codec::base16_encode(data, ec), ec, options) == data);
+            REQUIRE(rs::base_codec::base32_decode(rs::base_codec::base32_encode(data, ec), ec, options) == data);
+            REQUIRE(rs::base_codec::base32hex_decode(rs::base_codec::base32hex_encode(data, ec, false), ec, options) == data);
+            REQUIRE(rs::base_codec::base64_decode(rs::base_codec::base64_encode(data, ec), ec, options) == data);
+            REQUIRE(rs::base_codec::base64url_decode(rs::base_codec::base64url_encode(data, ec), ec, options) == data);
+            REQUIRE_FALSE(ec);
+        }
+    }
+
+    SECTION("Skipped characters shift the blocks across chunks")
+    {
+        auto const data = random_bytes(3000001, 3);
+        std::error_code ec;
+
+        // NOTE - Line breaks at an odd interval, so every chunk starts at a different bit offset.
+        auto const wrap = [](std::string const& a_encoded)
+        {
+            std::string ret;
+
+            for (std::size_t i = 0; i < a_encoded.size(); i += 77)
+            {
+                ret += a_encoded.substr(i, 77);
+                ret += "\r\n";
+            }
+
+            return ret;
+        };
+
+        auto const base16 = wrap(rs::base_codec::base16_encode(data, ec));
+        auto const base32 = wrap(rs::base_codec::base32_encode(data, ec));
+        auto const base64 = wrap(rs::base_codec::base64_encode(data, ec));
+
+        REQUIRE(rs::base_codec::base16_decode(base16, ec, options, false) == data);
+        REQUIRE(rs::base_codec::base32_decode(base32, ec, options, false) == data);
+        REQUIRE(rs::base_codec::base64_decode(base64, ec, options, false) == data);
+        REQUIRE_FALSE(ec);
+
+        REQUIRE(rs::base_codec::base64_decode(base64, ec, options).empty());
+        REQUIRE(ec == std::errc::invalid_argument);
+    }
+
+    SECTION("The earliest padding or invalid character wins")
+    {
+        auto const data = random_bytes(3000000, 4);
+        std::error_code ec;
+        auto encoded = rs::base_codec::base64_encode(data, ec);
+
+        encoded[encoded.size() / 2] = '=';
+        auto const truncated = rs::base_codec::base64_decode(encoded, ec, options);
+        REQUIRE(truncated == rs::base_codec::base64_decode(encoded, ec));
+        REQUIRE(truncated.size() == data.size() / 2);
+        REQUIRE_FALSE(ec);
+
+        // NOTE - Invalid characters after the padding are ignored, before it they are an error.
+        encoded[encoded.size() - 10] = '*';
+        REQUIRE(rs::base_codec::base64_decode(encoded, ec, options) == truncated);
+        REQUIRE_FALSE(ec);
+
+        encoded[10] = '*';
+        REQUIRE(rs::base_codec::base64_decode(encoded, ec, options).empty());
+        REQUIRE(ec == std::errc::invalid_argument);
+
+        ec.clear();
+        REQUIRE(rs::base_codec::base64_decode(encoded, ec, options, false) == rs::base_codec::base64_decode(encoded, ec, false));
+        REQUIRE_FALSE(ec);
+
+        auto const base16 = rs::base_codec::base16_encode(data, ec);
+        REQUIRE(rs::base_codec::base16_decode(std::string_view(base16).substr(1), ec, options).empty());
+        REQUIRE(ec == std::errc::invalid_argument);
+    }
+
+    SECTION("Caller provided buffers")
+    {
+        auto const data = random_bytes(1000003, 5);
+        std::error_code ec;
+
+        std::string encoded(rs::base_codec::base32_encoded_size(data.size()), '\0');
+        REQUIRE(rs::base_codec::base32_encode_into(data, encoded, ec, options) == encoded.size());
+        REQUIRE(encoded == rs::base_codec::base32_encode(data, ec));
+
+        std::vector<std::uint8_t> decoded(rs::base_codec::base32_decoded_size(encoded));
+        REQUIRE(rs::base_codec::base32_decode_into(encoded, decoded, ec, options) == data.size());
+        REQUIRE(decoded == data);
+        REQUIRE_FALSE(ec);
+
+        REQUIRE(rs::base_codec::base32_encode_into(data, std::span(encoded).first(10), ec, options) == 0);
+        REQUIRE(ec == std::errc::no_buffer_space);
+
+        ec.clear();
+        REQUIRE(rs::base_codec::base32_decode_into(encoded, std::span(decoded).first(10), ec, options) == 0);
+        REQUIRE(ec == std::errc::no_buffer_space);
+    }
+
+    SECTION("Small inputs stay on the calling thread")
+    {
+        struct counting_executor final : rs::base_codec::executor
+        {
+            std::size_t calls = 0;
+
+            auto do_bulk_execute(std::size_t a_count, std::function<void(std::size_t)> const& a_task) -> void override
+            {
+                ++calls;
+
+                for (std::size_t i = 0; i < a_count; ++i)
+                {
+                    a_task(i);
+                }
+            }
+
+            auto do_concurrency() const -> std::size_t override
+            {
+                return 8;
+            }
+        } counter;
+
+        auto const data = random_bytes(std::size_t {4} << 20, 7);
+        std::error_code ec;
+
+        auto const serial = rs::base_codec::base64_encode(data, ec, {&counter, data.size() + 1});
+        REQUIRE(counter.calls == 0);
+
+        REQUIRE(rs::base_codec::base64_encode(data, ec, {&counter, data.size()}) == serial);
+        REQUIRE(counter.calls == 1);
+        REQUIRE(serial == rs::base_codec::base64_encode(data, ec, rs::base_codec::parallel));
+        REQUIRE_FALSE(ec);
+    }
+
+    SECTION("Tasks run exactly once")
+    {
+        std::vector<std::atomic<int>> runs(1000);
+
+        pool.bulk_execute(runs.size(), [&](std::size_t a_index) { ++runs[a_index]; });
+        REQUIRE(std::ranges::all_of(runs, [](auto const& a_runs) { return a_runs == 1; }));
+    }
+}
+
+/**
+ * Transcoder expanding every byte fourfold, more than any codec of the library.
+ */
+struct repeating_transcoder
+{
+    static constexpr std::size_t factor = 4;
+
+    auto max_update_size(std::size_t a_size) const -> std::size_t
+    {
+        return a_size * factor;
+    }
+
+    auto update(
+        std::span<std::uint8_t const> a_data,
+        std::span<char> a_out,
+        std::error_code& a_ec
+    )
+    -> std::size_t
+    {
+        if (a_out.size() < max_update_size(a_data.size()))
+        {
+            a_ec = std::make_error_code(std::errc::no_buffer_space);
+            return 0;
+        }
+
+        for (std::size_t i = 0; i < a_data.size() * factor; ++i)
+        {
+            a_out[i] = static_cast<char>(a_data[i / factor]);
+        }
+
+        return a_data.size() * factor;
+    }
+
+    auto finish(
+        std::span<char> /* a_out */,
+        std::error_code& /* a_ec */
+    )
+    -> std::size_t
+    {
+        return 0;
+    }
+};
+
+TEST_CASE(
+    "File pipeline",
+    "[pipeline]"
+)
+{
+    auto const directory = std::filesystem::temp_directory_path();
+    auto const input = directory / "base_codec_pipeline_input";
+    auto const encoded = directory / "base_codec_pipeline_encoded";
+    auto const decoded = directory / "base_codec_pipeline_decoded";
+
+    auto const read_file = [](std::filesystem::path const& a_path)
+    {
+        std::ifstream file(a_path, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    };
+
+    auto const write_file = [](std::filesystem::path const& a_path, std::string const& a_data)
+    {
+        std::ofstream(a_path, std::ios::binary).write(a_data.data(), static_cast<std::streamsize>(a_data.size()));
+    };
+
+    for (bool io_uring : {true, false})
+    {
+        rs::base_codec::file_pipeline pipeline({std::size_t {1} << 16, 3, 8, io_uring});
+        INFO("io_uring " << pipeline.uses_io_uring());
+
+        if (!io_uring)
+        {
+            REQUIRE_FALSE(pipeline.uses_io_uring());
+        }
+
+        // NOTE - Sizes around the block size, which is not a whole number of encoder blocks.
+        for (std::size_t size : {0, 1, 65535, 65536, 65537, 1000003})
+        {
+            INFO("size " << size);
+            auto const data = random_bytes(size, static_cast<std::uint32_t>(size));
+            write_file(input, std::string(data.begin(), data.end()));
+
+            std::error_code ec;
+            rs::base_codec::base64_encoder encoder;
+            auto const written = pipeline.transcode(input, encoded, encoder, ec);
+            REQUIRE_FALSE(ec);
+            REQUIRE(read_file(encoded) == rs::base_codec::base64_encode(data, ec));
+            REQUIRE(written == rs::base_codec::base64_encoded_size(size));
+
+            rs::base_codec::base64_decoder decoder;
+            REQUIRE(pipeline.transcode(encoded, decoded, decoder, ec) == size);
+            REQUIRE_FALSE(ec);
+            REQUIRE(read_file(decoded) == std::string(data.begin(), data.end()));
+
+            rs::base_codec::base32hex_encoder base32_encoder(false);
+            pipeline.transcode(input, encoded, base32_encoder, ec);
+            REQUIRE(read_file(encoded) == rs::base_codec::base32hex_encode(data, ec, false));
+
+            rs::base_codec::base16_decoder base16_decoder;
+            write_file(encoded, rs::base_codec::base16_encode(data, ec));
+            pipeline.transcode(encoded, decoded, base16_decoder, ec);
+            REQUIRE(read_file(decoded) == std::string(data.begin(), data.end()));
+            REQUIRE_FALSE(ec);
+        }
+
+        std::error_code ec;
+        rs::base_codec::base64_decoder decoder;
+        write_file(encoded, std::string(200000, 'A') + "*");
+        pipeline.transcode(encoded, decoded, decoder, ec);
+        REQUIRE(ec == std::errc::invalid_argument);
+
+        ec.clear();
+        decoder.finish(ec);
+        pipeline.transcode(directory / "base_codec_pipeline_missing", decoded, decoder, ec);
+        REQUIRE(ec == std::errc::no_such_file_or_directory);
+
+        // NOTE - The output buffers are sized for the library's codecs at first.
+        {
+            auto const data = random_bytes(300000, 4);
+            write_file(input, std::string(data.begin(), data.end()));
+
+            ec.clear();
+            repeating_transcoder repeater;
+            REQUIRE(pipeline.transcode(input, encoded, repeater, ec) == data.size() * 4);
+            REQUIRE_FALSE(ec);
+
+            auto const repeated = read_file(encoded);
+            REQUIRE(repeated.size() == data.size() * 4);
+            REQUIRE(static_cast<std::uint8_t>(repeated[4 * 12345 + 3]) == data[12345]);
+            REQUIRE(static_cast<std::uint8_t>(repeated.back()) == data.back());
+        }
+
+        // NOTE - Reading a directory fails on the first read.
+        ec.clear();
+        rs::base_codec::base64_encoder encoder;
+        REQUIRE(pipeline.transcode(directory, decoded, encoder, ec) == 0);
+        REQUIRE(ec == std::errc::is_a_directory);
+    }
+
+    SECTION("Pipes are read and written at their current position")
+    {
+        // NOTE - Feeds the input through one pipe in small, uneven writes and drains the output
+        //        of another, on two threads, while the pipeline runs between the two.
+        auto const through_pipes = [](
+            rs::base_codec::file_pipeline& a_pipeline,
+            auto& a_transcoder,
+            std::string const& a_input,
+            std::error_code& a_ec
+        )
+        {
+            std::array<int, 2> in {};
+            std::array<int, 2> out {};
+            REQUIRE(::pipe(in.data()) == 0);
+            REQUIRE(::pipe(out.data()) == 0);
+
+            std::thread feeder([&]
+            {
+                constexpr std::array<std::size_t, 5> chunks {1, 7, 4093, 300, 65537};
+                std::size_t offset = 0;
+
+                for (std::size_t i = 0; offset < a_input.size(); ++i)
+                {
+                    auto const size = std::min(chunks[i % chunks.size()], a_input.size() - offset);
+                    auto const written = ::write(in[1], a_input.data() + offset, size);
+
+                    if (written <= 0)
+                    {
+                        break;
+                    }
+
+                    offset += static_cast<std::size_t>(written);
+                }
+
+                ::close(in[1]);
+            });
+
+            std::string output;
+            std::thread drainer([&]
+            {
+                std::array<char, 7001> buffer;
+                ::ssize_t read = 0;
+
+                while ((read = ::read(out[0], buffer.data(), buffer.size())) > 0)
+                {
+                    output.append(buffer.data(), static_cast<std::size_t>(read));
+                }
+            });
+
+            auto const written = a_pipeline.transcode(in[0], out[1], a_transcoder, a_ec);
+            ::close(out[1]);
+            feeder.join();
+            drainer.join();
+            ::close(in[0]);
+            ::close(out[0]);
+
+            REQUIRE(written == output.size());
+            return output;
+        };
+
+        for (bool io_uring : {true, false})
+        {
+            rs::base_codec::file_pipeline pipeline({std::size_t {1} << 16, 3, 8, io_uring});
+            INFO("io_uring " << pipeline.uses_io_uring());
+
+            for (std::size_t size : {0, 5, 100000, 3000001})
+            {
+                INFO("size " << size);
+                auto const data = random_bytes(size, static_cast<std::uint32_t>(size));
+
+                std::error_code ec;
+                rs::base_codec::base64_encoder encoder;
+                auto const base64 = through_pipes(
+                    pipeline,
+                    encoder,
+                    std::string(data.begin(), data.end()),
+                    ec
+                );
+                REQUIRE_FALSE(ec);
+                REQUIRE(base64 == rs::base_codec::base64_encode(data, ec));
+
+                rs::base_codec::base64_decoder decoder;
+                auto const decoded_data = through_pipes(pipeline, decoder, base64, ec);
+                REQUIRE_FALSE(ec);
+                REQUIRE(decoded_data == std::string(data.begin(), data.end()));
+            }
+        }
+    }
+
+    std::filesystem::remove(input);
+    std::filesystem::remove(encoded);
+    std::filesystem::remove(decoded);
+}
+
+TEST_CASE(
+    "Kernel dispatch",
+    "[dispatch]"
+)
+{
+    SECTION("Active tier is supported")
+    {
+        REQUIRE(rs::base_codec::is_kernel_tier_supported(rs::base_codec::active_kernel_tier()));
+        REQUIRE(rs::base_codec::best_kernel_tier() >= rs::base_codec::active_kernel_tier());
+        REQUIRE(rs::base_codec::kernel_tier_name(rs::base_codec::kernel_tier::avx2) == "avx2");
+    }
+
+    SECTION("Every tier matches the slowest one")
+    {
+        auto const initial = rs::base_codec::active_kernel_tier();
+        auto const tiers = supported_kernel_tiers();
+
+        for (std::size_t size : {0, 1, 2, 3, 4, 5, 15, 16, 31, 32, 47, 48, 63, 64, 95, 96, 97,
+                                 127, 128, 191, 192, 255, 256, 383, 1000, 4099})
+        {
+            auto const data = random_bytes(size, static_cast<std::uint32_t>(size));
+
+            std::error_code ec;
+            rs::base_codec::set_kernel_tier(tiers.front(), ec);
+            REQUIRE_FALSE(ec);
+
+            auto const base16 = rs::base_codec::base16_encode(data, ec);
+            auto const base32 = rs::base_codec::base32_encode(data, ec);
+            auto const base32hex = rs::base_codec::base32hex_encode(data, ec);
+            auto const base64 = rs::base_codec::base64_encode(data, ec);
+            auto const base64url = rs::base_codec::base64url_encode(data, ec);
+            REQUIRE_FALSE(ec);
+
+            for (auto const tier : tiers)
+            {
+                INFO("tier " << rs::base_codec::kernel_tier_name(tier) << ", size " << size);
+                rs::base_codec::set_kernel_tier(tier, ec);
+                REQUIRE_FALSE(ec);
+                REQUIRE(rs::base_codec::active_kernel_tier() == tier);
+
+                REQUIRE(rs::base_codec::base16_encode(data, ec) == base16);
+                REQUIRE(rs::base_codec::base32_encode(data, ec) == base32);
+                REQUIRE(rs::base_codec::base32hex_encode(data, ec) == base32hex);
+                REQUIRE(rs::base_codec::base64_encode(data, ec) == base64);
+                REQUIRE(rs::base_codec::base64url_encode(data, ec) == base64url);
+
+                REQUIRE(rs::base_codec::base16_decode(base16, ec) == data);
+                REQUIRE(rs::base_codec::base16_decode(lower_case(base16), ec) == data);
+                REQUIRE(rs::base_codec::base32_decode(base32, ec) == data);
+                REQUIRE(rs::base_codec::base32hex_decode(base32hex, ec) == data);
+                REQUIRE(rs::base_codec::base64_decode(base64, ec) == data);
+                REQUIRE(rs::base_codec::base64url_decode(base64url, ec) == data);
+                REQUIRE_FALSE(ec);
+
+                // NOTE - A line break in the middle pushes the rest of the input off the block
+                //        boundaries the kernels work on.
+                auto wrapped = base64;
+                wrapped.insert(wrapped.size() / 2, "\r\n");
+                REQUIRE(rs::base_codec::base64_decode(wrapped, ec, false) == data);
+                REQUIRE_FALSE(ec);
+
+                if (!data.empty())
+                {
+                    rs::base_codec::base64_decode(wrapped, ec);
+                    REQUIRE(ec);
+                    ec.clear();
+                }
+            }
+        }
+
+        std::error_code ec;
+        rs::base_codec::set_kernel_tier(initial, ec);
+        REQUIRE_FALSE(ec);
+    }
+
+    SECTION("Every tier rejects characters outside the alphabet")
+    {
+        auto const initial = rs::base_codec::active_kernel_tier();
+        auto const data = random_bytes(300, 300);
+
+        std::error_code ec;
+        auto const base16 = rs::base_codec::base16_encode(data, ec);
+        auto const base32 = rs::base_codec::base32_encode(data, ec);
+        auto const base32hex = rs::base_codec::base32hex_encode(data, ec);
+        auto const base64 = rs::base_codec::base64_encode(data, ec);
+        auto const base64url = rs::base_codec::base64url_encode(data, ec);
+
+        for (auto const tier : supported_kernel_tiers())
+        {
+            rs::base_codec::set_kernel_tier(tier, ec);
+            REQUIRE_FALSE(ec);
+
+            for (int c = 0; c < 256; ++c)
+            {
+                auto const symbol = static_cast<char>(c);
+                INFO("tier " << rs::base_codec::kernel_tier_name(tier) << ", character " << c);
+
+                auto const check = [&](auto const& a_encoded, auto a_decode, auto a_validate)
+                {
+                    rs::base_codec::validation_error error;
+
+                    if (symbol == '=' || a_validate(std::string(2, symbol), error))
+                    {
+                        return;
+                    }
+
+                    for (std::size_t position : {0, 37, 100, 257})
+                    {
+                        auto corrupted = a_encoded;
+                        corrupted[position] = symbol;
+
+                        std::error_code decode_ec;
+                        a_decode(corrupted, decode_ec);
+                        REQUIRE(decode_ec);
+
+                        REQUIRE_FALSE(a_validate(corrupted, error));
+                        REQUIRE(error.offset == position);
+                        REQUIRE(error.value == symbol);
+                    }
+                };
+
+                check(base16, [](auto const& a, auto& e) { return rs::base_codec::base16_decode(a, e); },
+                      [](auto const& a, auto& e) { return rs::base_codec::is_base16(a, e); });
+                check(base32, [](auto const& a, auto& e) { return rs::base_codec::base32_decode(a, e); },
+                      [](auto const& a, auto& e) { return rs::base_codec::is_base32(a, e); });
+                check(base32hex, [](auto const& a, auto& e) { return rs::base_codec::base32hex_decode(a, e); },
+                      [](auto const& a, auto& e) { return rs::base_codec::is_base32hex(a, e); });
+                check(base64, [](auto const& a, auto& e) { return rs::base_codec::base64_decode(a, e); },
+                      [](auto const& a, auto& e) { return rs::base_codec::is_base64(a, e); });
+                check(base64url, [](auto const& a, auto& e) { return rs::base_codec::base64url_decode(a, e); },
+                      [](auto const& a, auto& e) { return rs::base_codec::is_base64url(a, e); });
+            }
+        }
+
+        rs::base_codec::set_kernel_tier(initial, ec);
+        REQUIRE_FALSE(ec);
+    }
+}
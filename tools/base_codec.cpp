@@ -0,0 +1,1060 @@
+/**
+ * @file base_codec.cpp
+ *
+ * Command line transcoder in the spirit of `basenc`, built on the library. Regular files are
+ * memory mapped and transcoded by the parallel routines straight from the input mapping into the
+ * output mapping (or a single buffer, when the output isn't a file). Pipes and terminals are
+ * streamed through in large blocks.
+ *
+ * Like `basenc`, the encoding is wrapped into lines of 76 characters by default, and line breaks
+ * are skipped when decoding - also in strict mode, which still rejects everything else outside
+ * the alphabet.
+ */
+#include <base_codec/base16.hpp>
+#include <base_codec/base32.hpp>
+#include <base_codec/base64.hpp>
+#include <base_codec/parallel.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include <fcntl.h>
+#include <getopt.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+namespace
+{
+
+/**
+ * Size of the blocks read from pipes and terminals.
+ */
+constexpr std::size_t stream_block_size = std::size_t {4} << 20;
+
+/**
+ * Line length of the encoding, as with `basenc`.
+ */
+constexpr std::size_t default_wrap = 76;
+
+enum class codec_kind
+{
+    base16,
+    base32,
+    base32hex,
+    base64,
+    base64url
+};
+
+struct options
+{
+    codec_kind codec = codec_kind::base64;
+    bool decode = false;
+    bool strict = true;
+    std::optional<bool> padding;
+    char pad_character = '=';
+    std::size_t threads = 0;
+    std::size_t wrap = default_wrap;
+    std::string input = "-";
+    std::string output = "-";
+};
+
+/**
+ * Thin wrappers giving every codec the same interface, so the transcoding loops are written once.
+ */
+struct base16_codec
+{
+    static constexpr bool default_padding = false;
+
+    static auto encoded_size(std::size_t a_size, bool /* a_padding */) -> std::size_t
+    {
+        return rs::base_codec::base16_encoded_size(a_size);
+    }
+
+    static auto decoded_size(std::string_view a_data, char /* a_pad_character */) -> std::size_t
+    {
+        return rs::base_codec::base16_decoded_size(a_data);
+    }
+
+    static auto encode_into(
+        std::span<std::uint8_t const> a_data,
+        std::span<char> a_out,
+        std::error_code& a_ec,
+        rs::base_codec::parallel_options const& a_options,
+        options const& /* a_cli */
+    )
+    -> std::size_t
+    {
+        return rs::base_codec::base16_encode_into(a_data, a_out, a_ec, a_options);
+    }
+
+    static auto decode_into(
+        std::string_view a_data,
+        std::span<std::uint8_t> a_out,
+        std::error_code& a_ec,
+        rs::base_codec::parallel_options const& a_options,
+        options const& a_cli
+    )
+    -> std::size_t
+    {
+        return rs::base_codec::base16_decode_into(a_data, a_out, a_ec, a_options, a_cli.strict);
+    }
+
+    static auto encoder(options const& /* a_cli */) -> rs::base_codec::base16_encoder
+    {
+        return rs::base_codec::base16_encoder();
+    }
+
+    static auto decoder(options const& a_cli) -> rs::base_codec::base16_decoder
+    {
+        return rs::base_codec::base16_decoder(a_cli.strict);
+    }
+};
+
+template <
+    typename Encoder,
+    typename Decoder,
+    auto EncodedSize,
+    auto DecodedSize,
+    auto EncodeInto,
+    auto DecodeInto,
+    bool DefaultPadding
+>
+struct padded_codec
+{
+    static constexpr bool default_padding = DefaultPadding;
+
+    static auto encoded_size(std::size_t a_size, bool a_padding) -> std::size_t
+    {
+        return EncodedSize(a_size, a_padding);
+    }
+
+    static auto decoded_size(std::string_view a_data, char a_pad_character) -> std::size_t
+    {
+        return DecodedSize(a_data, a_pad_character);
+    }
+
+    static auto encode_into(
+        std::span<std::uint8_t const> a_data,
+        std::span<char> a_out,
+        std::error_code& a_ec,
+        rs::base_codec::parallel_options const& a_options,
+        options const& a_cli
+    )
+    -> std::size_t
+    {
+        return EncodeInto(
+            a_data,
+            a_out,
+            a_ec,
+            a_options,
+            a_cli.padding.value_or(DefaultPadding),
+            a_cli.pad_character
+        );
+    }
+
+    static auto decode_into(
+        std::string_view a_data,
+        std::span<std::uint8_t> a_out,
+        std::error_code& a_ec,
+        rs::base_codec::parallel_options const& a_options,
+        options const& a_cli
+    )
+    -> std::size_t
+    {
+        return DecodeInto(a_data, a_out, a_ec, a_options, a_cli.strict, a_cli.pad_character);
+    }
+
+    static auto encoder(options const& a_cli) -> Encoder
+    {
+        return Encoder(a_cli.padding.value_or(DefaultPadding), a_cli.pad_character);
+    }
+
+    static auto decoder(options const& a_cli) -> Decoder
+    {
+        return Decoder(a_cli.strict, a_cli.pad_character);
+    }
+};
+
+// NOTE - The parallel `_into` overloads, picked out of their overload sets by their signature.
+using encode_into_fn = std::size_t (*)(
+    std::span<std::uint8_t const>,
+    std::span<char>,
+    std::error_code&,
+    rs::base_codec::parallel_options const&,
+    bool,
+    char
+);
+
+using decode_into_fn = std::size_t (*)(
+    std::string_view const&,
+    std::span<std::uint8_t>,
+    std::error_code&,
+    rs::base_codec::parallel_options const&,
+    bool,
+    char
+);
+
+using base32_codec = padded_codec<
+    rs::base_codec::base32_encoder,
+    rs::base_codec::base32_decoder,
+    &rs::base_codec::base32_encoded_size,
+    &rs::base_codec::base32_decoded_size,
+    static_cast<encode_into_fn>(&rs::base_codec::base32_encode_into),
+    static_cast<decode_into_fn>(&rs::base_codec::base32_decode_into),
+    true
+>;
+
+using base32hex_codec = padded_codec<
+    rs::base_codec::base32hex_encoder,
+    rs::base_codec::base32hex_decoder,
+    &rs::base_codec::base32_encoded_size,
+    &rs::base_codec::base32_decoded_size,
+    static_cast<encode_into_fn>(&rs::base_codec::base32hex_encode_into),
+    static_cast<decode_into_fn>(&rs::base_codec::base32hex_decode_into),
+    true
+>;
+
+using base64_codec = padded_codec<
+    rs::base_codec::base64_encoder,
+    rs::base_codec::base64_decoder,
+    &rs::base_codec::base64_encoded_size,
+    &rs::base_codec::base64_decoded_size,
+    static_cast<encode_into_fn>(&rs::base_codec::base64_encode_into),
+    static_cast<decode_into_fn>(&rs::base_codec::base64_decode_into),
+    true
+>;
+
+using base64url_codec = padded_codec<
+    rs::base_codec::base64url_encoder,
+    rs::base_codec::base64url_decoder,
+    &rs::base_codec::base64_encoded_size,
+    &rs::base_codec::base64_decoded_size,
+    static_cast<encode_into_fn>(&rs::base_codec::base64url_encode_into),
+    static_cast<decode_into_fn>(&rs::base_codec::base64url_decode_into),
+    false
+>;
+
+auto report(std::string_view a_what, std::string_view a_message) -> int
+{
+    std::fprintf(
+        stderr,
+        "base_codec: %.*s: %.*s\n",
+        static_cast<int>(a_what.size()),
+        a_what.data(),
+        static_cast<int>(a_message.size()),
+        a_message.data()
+    );
+    return EXIT_FAILURE;
+}
+
+auto report_errno(std::string_view a_what) -> int
+{
+    return report(a_what, std::strerror(errno));
+}
+
+/**
+ * Owns a file descriptor, leaving the standard streams open.
+ */
+class file
+{
+public:
+    explicit file(int a_fd = -1)
+        : m_fd(a_fd)
+    {
+    }
+
+    file(file const&) = delete;
+    auto operator=(file const&) -> file& = delete;
+
+    ~file()
+    {
+        if (m_fd > STDERR_FILENO)
+        {
+            ::close(m_fd);
+        }
+    }
+
+    auto fd() const -> int
+    {
+        return m_fd;
+    }
+
+private:
+    int m_fd;
+};
+
+/**
+ * Owns a memory mapping.
+ */
+class mapping
+{
+public:
+    mapping() = default;
+
+    mapping(
+        void* a_address,
+        std::size_t a_size
+    )
+        : m_address(a_address)
+        , m_size(a_size)
+    {
+    }
+
+    mapping(mapping const&) = delete;
+    auto operator=(mapping const&) -> mapping& = delete;
+
+    ~mapping()
+    {
+        if (m_address != nullptr)
+        {
+            ::munmap(m_address, m_size);
+        }
+    }
+
+    auto data() const -> char*
+    {
+        return static_cast<char*>(m_address);
+    }
+
+    auto size() const -> std::size_t
+    {
+        return m_size;
+    }
+
+private:
+    void* m_address = nullptr;
+    std::size_t m_size = 0;
+};
+
+/**
+ * Maps a whole file, returning an empty mapping for an empty file.
+ */
+auto map_file(
+    int a_fd,
+    std::size_t a_size,
+    int a_protection,
+    int a_flags,
+    int a_advice
+)
+-> std::unique_ptr<mapping>
+{
+    if (a_size == 0)
+    {
+        return std::make_unique<mapping>();
+    }
+
+    auto* const address = ::mmap(nullptr, a_size, a_protection, a_flags, a_fd, 0);
+
+    if (address == MAP_FAILED)
+    {
+        return nullptr;
+    }
+
+    ::madvise(address, a_size, a_advice);
+
+    return std::make_unique<mapping>(address, a_size);
+}
+
+auto write_all(
+    int a_fd,
+    void const* a_data,
+    std::size_t a_size
+)
+-> bool
+{
+    auto const* data = static_cast<char const*>(a_data);
+
+    while (a_size > 0)
+    {
+        auto const written = ::write(a_fd, data, a_size);
+
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            return false;
+        }
+
+        data += written;
+        a_size -= static_cast<std::size_t>(written);
+    }
+
+    return true;
+}
+
+/**
+ * Reads until the buffer is full or the input ends, returning the number of bytes read or -1.
+ */
+auto read_block(
+    int a_fd,
+    std::span<char> a_buffer
+)
+-> ssize_t
+{
+    std::size_t size = 0;
+
+    while (size < a_buffer.size())
+    {
+        auto const read = ::read(a_fd, a_buffer.data() + size, a_buffer.size() - size);
+
+        if (read < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            return -1;
+        }
+
+        if (read == 0)
+        {
+            break;
+        }
+
+        size += static_cast<std::size_t>(read);
+    }
+
+    return static_cast<ssize_t>(size);
+}
+
+/**
+ * Number of characters of an encoding of `a_size` characters once wrapped, each line ending with a
+ * line feed. A width of 0 leaves the encoding on a single line, without a line feed.
+ */
+auto wrapped_size(
+    std::size_t a_size,
+    std::size_t a_width
+)
+-> std::size_t
+{
+    return a_width == 0 ? a_size : a_size + (a_size + a_width - 1) / a_width;
+}
+
+/**
+ * Wraps an encoding within its own buffer, which has to hold `wrapped_size(a_size, a_width)`
+ * characters. The lines get moved into place from the last one, whose destination is past the end
+ * of every line not yet moved.
+ */
+auto wrap_in_place(
+    char* a_data,
+    std::size_t a_size,
+    std::size_t a_width
+)
+-> std::size_t
+{
+    if (a_width == 0 || a_size == 0)
+    {
+        return a_size;
+    }
+
+    for (auto line = (a_size - 1) / a_width + 1; line-- > 0;)
+    {
+        auto const begin = line * a_width;
+        auto const length = std::min(a_width, a_size - begin);
+        auto* const destination = a_data + line * (a_width + 1);
+
+        std::memmove(destination, a_data + begin, length);
+        destination[length] = '\n';
+    }
+
+    return wrapped_size(a_size, a_width);
+}
+
+/**
+ * Appends the next piece of a streamed encoding to `a_out`, starting a new line every `a_width`
+ * characters. `a_column` carries the length of the current line from one piece to the next.
+ */
+auto append_wrapped(
+    std::string_view a_data,
+    std::size_t a_width,
+    std::size_t& a_column,
+    std::vector<char>& a_out
+)
+-> void
+{
+    if (a_width == 0)
+    {
+        a_out.insert(a_out.end(), a_data.begin(), a_data.end());
+        return;
+    }
+
+    while (!a_data.empty())
+    {
+        auto const length = std::min(a_width - a_column, a_data.size());
+        a_out.insert(a_out.end(), a_data.begin(), a_data.begin() + length);
+        a_data.remove_prefix(length);
+        a_column += length;
+
+        if (a_column == a_width)
+        {
+            a_out.push_back('\n');
+            a_column = 0;
+        }
+    }
+}
+
+/**
+ * Drops the line breaks of a wrapped encoding - line feeds and the carriage returns right before
+ * them - leaving everything else to the decoder. A carriage return ending the data is held back
+ * in `a_carriage_return`, as its line feed may only come with the next block.
+ *
+ * @returns std::size_t Number of characters written to `a_out`, which has to hold one more
+ * character than `a_data`.
+ */
+auto remove_line_breaks(
+    std::string_view a_data,
+    char* a_out,
+    bool& a_carriage_return
+)
+-> std::size_t
+{
+    std::size_t out = 0;
+
+    if (a_carriage_return && !a_data.empty())
+    {
+        a_carriage_return = false;
+
+        if (a_data.front() != '\n')
+        {
+            a_out[out++] = '\r';
+        }
+    }
+
+    while (!a_data.empty())
+    {
+        auto const line_feed = a_data.find('\n');
+        auto line = a_data.substr(0, line_feed);
+
+        if (line_feed != std::string_view::npos)
+        {
+            a_data.remove_prefix(line_feed + 1);
+        } else
+        {
+            a_data = {};
+        }
+
+        if (!line.empty() && line.back() == '\r')
+        {
+            line.remove_suffix(1);
+            a_carriage_return = line_feed == std::string_view::npos;
+        }
+
+        std::memcpy(a_out + out, line.data(), line.size());
+        out += line.size();
+    }
+
+    return out;
+}
+
+/**
+ * Transcodes a memory mapped input in one go on the parallel routines. A file output gets mapped
+ * too and written in place, anything else gets the result from one buffer.
+ */
+template <typename Codec>
+auto transcode_mapped(
+    std::span<char const> a_input,
+    int a_output,
+    bool a_output_mappable,
+    options const& a_cli,
+    rs::base_codec::parallel_options const& a_parallel
+)
+-> int
+{
+    std::error_code ec;
+    std::string_view text(a_input.data(), a_input.size());
+    std::span<std::uint8_t const> const bytes(
+        reinterpret_cast<std::uint8_t const*>(a_input.data()),
+        a_input.size()
+    );
+
+    // NOTE - Trailing line breaks are simply cut off, only wrapped input has to be copied without
+    //        its line breaks before it can be decoded.
+    std::unique_ptr<char[]> unwrapped;
+
+    if (a_cli.decode)
+    {
+        while (!text.empty() && text.back() == '\n')
+        {
+            text.remove_suffix(text.size() > 1 && text[text.size() - 2] == '\r' ? 2 : 1);
+        }
+
+        if (text.find('\n') != std::string_view::npos)
+        {
+            unwrapped.reset(new char[text.size() + 1]);
+            bool carriage_return = false;
+            auto size = remove_line_breaks(text, unwrapped.get(), carriage_return);
+
+            if (carriage_return)
+            {
+                unwrapped[size++] = '\r';
+            }
+
+            text = std::string_view(unwrapped.get(), size);
+        }
+    }
+
+    auto const encoded_size = Codec::encoded_size(
+        a_input.size(),
+        a_cli.padding.value_or(Codec::default_padding)
+    );
+    auto const capacity = a_cli.decode
+        ? Codec::decoded_size(text, a_cli.pad_character)
+        : wrapped_size(encoded_size, a_cli.wrap);
+
+    auto const transcode = [&](char* a_out) -> std::size_t
+    {
+        if (a_cli.decode)
+        {
+            return Codec::decode_into(
+                text,
+                std::span<std::uint8_t>(reinterpret_cast<std::uint8_t*>(a_out), capacity),
+                ec,
+                a_parallel,
+                a_cli
+            );
+        }
+
+        auto const written = Codec::encode_into(
+            bytes,
+            std::span<char>(a_out, encoded_size),
+            ec,
+            a_parallel,
+            a_cli
+        );
+
+        return ec ? 0 : wrap_in_place(a_out, written, a_cli.wrap);
+    };
+
+    if (a_output_mappable)
+    {
+        if (::ftruncate(a_output, static_cast<off_t>(capacity)) != 0)
+        {
+            return report_errno(a_cli.output);
+        }
+
+        auto const out = map_file(
+            a_output,
+            capacity,
+            PROT_READ | PROT_WRITE,
+            MAP_SHARED,
+            MADV_SEQUENTIAL
+        );
+
+        if (out)
+        {
+            auto const written = transcode(out->data());
+
+            // NOTE - Decoding may come out shorter than its upper bound, or fail altogether.
+            if (::ftruncate(a_output, static_cast<off_t>(ec ? 0 : written)) != 0)
+            {
+                return report_errno(a_cli.output);
+            }
+
+            return ec ? report(a_cli.input, "invalid input") : EXIT_SUCCESS;
+        }
+    }
+
+    std::unique_ptr<char[]> buffer(new char[std::max<std::size_t>(capacity, 1)]);
+    auto const written = transcode(buffer.get());
+
+    if (ec)
+    {
+        return report(a_cli.input, "invalid input");
+    }
+
+    if (!write_all(a_output, buffer.get(), written))
+    {
+        return report_errno(a_cli.output);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/**
+ * Transcodes an input which can't be mapped - a pipe or a terminal - through the streaming
+ * encoders and decoders, one large block at a time.
+ */
+template <typename Codec>
+auto transcode_stream(
+    int a_input,
+    int a_output,
+    options const& a_cli
+)
+-> int
+{
+    std::error_code ec;
+    std::vector<char> in(stream_block_size);
+    std::vector<char> unwrapped(stream_block_size + 1);
+    std::vector<char> out;
+    std::vector<char> wrapped;
+    std::size_t column = 0;
+    bool carriage_return = false;
+
+    auto encoder = Codec::encoder(a_cli);
+    auto decoder = Codec::decoder(a_cli);
+
+    while (true)
+    {
+        auto const read = read_block(a_input, in);
+
+        if (read < 0)
+        {
+            return report_errno(a_cli.input);
+        }
+
+        if (read == 0)
+        {
+            break;
+        }
+
+        auto const size = static_cast<std::size_t>(read);
+
+        if (a_cli.decode)
+        {
+            auto const data = remove_line_breaks(
+                std::string_view(in.data(), size),
+                unwrapped.data(),
+                carriage_return
+            );
+
+            out.resize(decoder.max_update_size(data));
+            auto const written = decoder.update(
+                std::string_view(unwrapped.data(), data),
+                std::span<std::uint8_t>(reinterpret_cast<std::uint8_t*>(out.data()), out.size()),
+                ec
+            );
+
+            if (ec)
+            {
+                return report(a_cli.input, "invalid input");
+            }
+
+            if (!write_all(a_output, out.data(), written))
+            {
+                return report_errno(a_cli.output);
+            }
+        } else
+        {
+            out.resize(encoder.max_update_size(size));
+            auto const written = encoder.update(
+                std::span<std::uint8_t const>(reinterpret_cast<std::uint8_t const*>(in.data()), size),
+                out,
+                ec
+            );
+
+            wrapped.clear();
+            append_wrapped(std::string_view(out.data(), written), a_cli.wrap, column, wrapped);
+
+            if (!write_all(a_output, wrapped.data(), wrapped.size()))
+            {
+                return report_errno(a_cli.output);
+            }
+        }
+    }
+
+    if (a_cli.decode)
+    {
+        // NOTE - A carriage return without a line feed is left for the decoder to reject.
+        if (carriage_return)
+        {
+            std::array<std::uint8_t, 8> last {};
+            decoder.update("\r", last, ec);
+        }
+
+        decoder.finish(ec);
+
+        return ec ? report(a_cli.input, "invalid input") : EXIT_SUCCESS;
+    }
+
+    out.resize(encoder.max_finish_size());
+    auto const written = encoder.finish(out, ec);
+
+    wrapped.clear();
+    append_wrapped(std::string_view(out.data(), written), a_cli.wrap, column, wrapped);
+
+    if (column != 0)
+    {
+        wrapped.push_back('\n');
+    }
+
+    if (!write_all(a_output, wrapped.data(), wrapped.size()))
+    {
+        return report_errno(a_cli.output);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+template <typename Codec>
+auto run(options const& a_cli) -> int
+{
+    file const input(
+        a_cli.input == "-" ? STDIN_FILENO : ::open(a_cli.input.c_str(), O_RDONLY | O_CLOEXEC)
+    );
+
+    if (input.fd() < 0)
+    {
+        return report_errno(a_cli.input);
+    }
+
+    // NOTE - Mapping the output needs read access too, so a named output gets opened read-write.
+    file const output(
+        a_cli.output == "-"
+            ? STDOUT_FILENO
+            : ::open(a_cli.output.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0666)
+    );
+
+    if (output.fd() < 0)
+    {
+        return report_errno(a_cli.output);
+    }
+
+    struct stat input_stat {};
+
+    if (::fstat(input.fd(), &input_stat) != 0)
+    {
+        return report_errno(a_cli.input);
+    }
+
+    if (!S_ISREG(input_stat.st_mode))
+    {
+        return transcode_stream<Codec>(input.fd(), output.fd(), a_cli);
+    }
+
+    auto const in = map_file(
+        input.fd(),
+        static_cast<std::size_t>(input_stat.st_size),
+        PROT_READ,
+        MAP_PRIVATE,
+        MADV_SEQUENTIAL
+    );
+
+    if (!in)
+    {
+        return transcode_stream<Codec>(input.fd(), output.fd(), a_cli);
+    }
+
+    std::unique_ptr<rs::base_codec::thread_pool> pool;
+    rs::base_codec::parallel_options parallel;
+
+    if (a_cli.threads != 0)
+    {
+        pool = std::make_unique<rs::base_codec::thread_pool>(a_cli.threads);
+        parallel.target = pool.get();
+    }
+
+    struct stat output_stat {};
+    bool const output_mappable = a_cli.output != "-" &&
+                                 ::fstat(output.fd(), &output_stat) == 0 &&
+                                 S_ISREG(output_stat.st_mode);
+
+    return transcode_mapped<Codec>(
+        std::span<char const>(in->data(), in->size()),
+        output.fd(),
+        output_mappable,
+        a_cli,
+        parallel
+    );
+}
+
+constexpr std::string_view usage =
+    "Usage: base_codec [OPTION]... [FILE]\n"
+    "Encode or decode FILE, or standard input, to standard output.\n"
+    "\n"
+    "      --base16          hex encoding (RFC 4648 section 8)\n"
+    "      --base32          Base32 encoding (RFC 4648 section 6)\n"
+    "      --base32hex       extended hex alphabet Base32 (RFC 4648 section 7)\n"
+    "      --base64          Base64 encoding (RFC 4648 section 4), the default\n"
+    "      --base64url       file- and url-safe Base64 (RFC 4648 section 5)\n"
+    "  -d, --decode          decode data, skipping line breaks\n"
+    "  -i, --ignore-garbage  when decoding, skip any character outside the alphabet\n"
+    "  -p, --padding         pad the encoding (default except for Base64Url)\n"
+    "  -n, --no-padding      don't pad the encoding\n"
+    "  -c, --pad-char=C      use C as the padding character instead of '='\n"
+    "  -w, --wrap=COLS       wrap encoded lines after COLS characters (default 76),\n"
+    "                        0 for a single line without a line feed\n"
+    "  -o, --output=FILE     write to FILE instead of standard output\n"
+    "  -j, --threads=N       transcode on N threads, 0 for all of them (default)\n"
+    "  -h, --help            display this help and exit\n"
+    "\n"
+    "Regular files are memory mapped and transcoded on several threads. The kernel tier can be\n"
+    "picked with the BASE_CODEC_KERNEL environment variable (scalar, sse41, avx2, avx512).\n";
+
+auto parse(
+    int a_argc,
+    char** a_argv,
+    options& a_options
+)
+-> bool
+{
+    enum long_only : int
+    {
+        opt_base16 = 256,
+        opt_base32,
+        opt_base32hex,
+        opt_base64,
+        opt_base64url
+    };
+
+    static constexpr option long_options[] {
+        {"base16", no_argument, nullptr, opt_base16},
+        {"base32", no_argument, nullptr, opt_base32},
+        {"base32hex", no_argument, nullptr, opt_base32hex},
+        {"base64", no_argument, nullptr, opt_base64},
+        {"base64url", no_argument, nullptr, opt_base64url},
+        {"decode", no_argument, nullptr, 'd'},
+        {"ignore-garbage", no_argument, nullptr, 'i'},
+        {"padding", no_argument, nullptr, 'p'},
+        {"no-padding", no_argument, nullptr, 'n'},
+        {"pad-char", required_argument, nullptr, 'c'},
+        {"wrap", required_argument, nullptr, 'w'},
+        {"output", required_argument, nullptr, 'o'},
+        {"threads", required_argument, nullptr, 'j'},
+        {"help", no_argument, nullptr, 'h'},
+        {nullptr, 0, nullptr, 0}
+    };
+
+    int opt = 0;
+
+    while ((opt = ::getopt_long(a_argc, a_argv, "dipnc:w:o:j:h", long_options, nullptr)) != -1)
+    {
+        switch (opt)
+        {
+        case opt_base16:
+            a_options.codec = codec_kind::base16;
+            break;
+        case opt_base32:
+            a_options.codec = codec_kind::base32;
+            break;
+        case opt_base32hex:
+            a_options.codec = codec_kind::base32hex;
+            break;
+        case opt_base64:
+            a_options.codec = codec_kind::base64;
+            break;
+        case opt_base64url:
+            a_options.codec = codec_kind::base64url;
+            break;
+        case 'd':
+            a_options.decode = true;
+            break;
+        case 'i':
+            a_options.strict = false;
+            break;
+        case 'p':
+            a_options.padding = true;
+            break;
+        case 'n':
+            a_options.padding = false;
+            break;
+        case 'c':
+            if (std::strlen(::optarg) != 1)
+            {
+                report("--pad-char", "expected a single character");
+                return false;
+            }
+
+            a_options.pad_character = ::optarg[0];
+            break;
+        case 'w':
+        {
+            char* end = nullptr;
+            a_options.wrap = std::strtoull(::optarg, &end, 10);
+
+            if (end == ::optarg || *end != '\0')
+            {
+                report("--wrap", "expected a number");
+                return false;
+            }
+
+            break;
+        }
+        case 'o':
+            a_options.output = ::optarg;
+            break;
+        case 'j':
+        {
+            char* end = nullptr;
+            a_options.threads = std::strtoull(::optarg, &end, 10);
+
+            if (end == ::optarg || *end != '\0')
+            {
+                report("--threads", "expected a number");
+                return false;
+            }
+
+            break;
+        }
+        case 'h':
+            std::fwrite(usage.data(), 1, usage.size(), stdout);
+            std::exit(EXIT_SUCCESS);
+        default:
+            std::fwrite(usage.data(), 1, usage.size(), stderr);
+            return false;
+        }
+    }
+
+    if (::optind + 1 < a_argc)
+    {
+        report(a_argv[::optind + 1], "extra operand");
+        return false;
+    }
+
+    if (::optind < a_argc)
+    {
+        a_options.input = a_argv[::optind];
+    }
+
+    return true;
+}
+
+}   // namespace
+
+auto main(
+    int a_argc,
+    char** a_argv
+)
+-> int
+{
+    options cli;
+
+    if (!parse(a_argc, a_argv, cli))
+    {
+        return EXIT_FAILURE;
+    }
+
+    switch (cli.codec)
+    {
+    case codec_kind::base16:
+        return run<base16_codec>(cli);
+    case codec_kind::base32:
+        return run<base32_codec>(cli);
+    case codec_kind::base32hex:
+        return run<base32hex_codec>(cli);
+    case codec_kind::base64:
+        return run<base64_codec>(cli);
+    case codec_kind::base64url:
+        return run<base64url_codec>(cli);
+    }
+
+    return EXIT_FAILURE;
+}